@@ -88,6 +88,162 @@ void    ccladd (cclp, ch)
 	ccltbl[newpos] = ch;
 }
 
+/* ccladd_range - add the characters lo through hi to a ccl
+ *
+ * With --utf8, lo and hi are code points; the ones outside ASCII don't fit
+ * in ccltbl, so they're kept on the ccl's list of ranges instead.
+ */
+
+void    ccladd_range (cclp, lo, hi)
+     int     cclp, lo, hi;
+{
+	int     i;
+
+	if (utf8 && hi >= 0x80) {
+		if (lo < 0x80) {
+			ccladd_range (cclp, lo, 0x7f);
+			lo = 0x80;
+		}
+
+		if (++lastrng >= current_max_rngs) {
+			current_max_rngs += MAX_RNGS_INCREMENT;
+
+			++num_reallocs;
+
+			rngfirst = reallocate_integer_array (rngfirst,
+							     current_max_rngs);
+			rnglast = reallocate_integer_array (rnglast,
+							    current_max_rngs);
+			rngnext = reallocate_integer_array (rngnext,
+							    current_max_rngs);
+		}
+
+		rngfirst[lastrng] = lo;
+		rnglast[lastrng] = hi;
+		rngnext[lastrng] = cclrng[cclp];
+		cclrng[cclp] = lastrng;
+		return;
+	}
+
+	for (i = lo; i <= hi; ++i)
+		ccladd (cclp, i);
+}
+
+
+/* rngcmp - compare two code point ranges by their first code point */
+
+static int rngcmp (const void *a, const void *b)
+{
+	return *(const int *) a - *(const int *) b;
+}
+
+
+/* ccl_ranges - list the code points a ccl matches, with --utf8
+ *
+ * Sets *rangesp to a new array of first/last pairs, sorted, with no two
+ * pairs overlapping or touching, and returns the number of pairs.
+ * Negation is taken into account, and the surrogates, which UTF-8 text
+ * never holds, are left out.  The caller frees the array.
+ */
+
+int     ccl_ranges (cclp, rangesp)
+     int     cclp;
+     int   **rangesp;
+{
+	int    *r;
+	int     n, i, j, next;
+
+	n = ccllen[cclp];
+	for (i = cclrng[cclp]; i != 0; i = rngnext[i])
+		++n;
+
+	/* Room for one more pair from negating, and one from splitting
+	 * a range around the surrogates.
+	 */
+	r = allocate_integer_array (2 * (n + 2));
+
+	n = 0;
+	for (i = 0; i < ccllen[cclp]; ++i, ++n)
+		r[2 * n] = r[2 * n + 1] = ccltbl[cclmap[cclp] + i];
+
+	for (i = cclrng[cclp]; i != 0; i = rngnext[i], ++n) {
+		r[2 * n] = rngfirst[i];
+		r[2 * n + 1] = rnglast[i];
+	}
+
+	qsort (r, n, 2 * sizeof (int), rngcmp);
+
+	/* Merge the pairs that overlap or touch. */
+	for (i = 0, j = -1; i < n; ++i)
+		if (j >= 0 && r[2 * i] <= r[2 * j + 1] + 1) {
+			if (r[2 * i + 1] > r[2 * j + 1])
+				r[2 * j + 1] = r[2 * i + 1];
+		}
+		else {
+			++j;
+			r[2 * j] = r[2 * i];
+			r[2 * j + 1] = r[2 * i + 1];
+		}
+	n = j + 1;
+
+	if (cclng[cclp]) {
+		/* Replace the pairs with the gaps between them, working
+		 * from the end since there may be one more gap than pairs.
+		 */
+		next = UTF8_MAX + 1;
+		j = n + 1;
+		for (i = n - 1; i >= -1; --i) {
+			int     lo = i >= 0 ? r[2 * i + 1] + 1 : 0;
+
+			if (lo < next) {
+				--j;
+				r[2 * j + 1] = next - 1;
+				r[2 * j] = lo;
+			}
+			if (i >= 0)
+				next = r[2 * i];
+		}
+
+		for (i = 0; j <= n; ++i, ++j) {
+			r[2 * i] = r[2 * j];
+			r[2 * i + 1] = r[2 * j + 1];
+		}
+		n = i;
+	}
+
+	/* Cut out the surrogates. */
+	for (i = 0; i < n; ++i) {
+		if (r[2 * i + 1] < 0xd800 || r[2 * i] > 0xdfff)
+			continue;
+
+		if (r[2 * i] < 0xd800 && r[2 * i + 1] > 0xdfff) {
+			for (j = n; j > i; --j) {
+				r[2 * j] = r[2 * j - 2];
+				r[2 * j + 1] = r[2 * j - 1];
+			}
+			++n;
+			r[2 * i + 1] = 0xd7ff;
+			r[2 * i + 2] = 0xe000;
+		}
+		else if (r[2 * i] < 0xd800)
+			r[2 * i + 1] = 0xd7ff;
+		else if (r[2 * i + 1] > 0xdfff)
+			r[2 * i] = 0xe000;
+		else {
+			for (j = i; j < n - 1; ++j) {
+				r[2 * j] = r[2 * j + 2];
+				r[2 * j + 1] = r[2 * j + 3];
+			}
+			--n;
+			--i;
+		}
+	}
+
+	*rangesp = r;
+	return n;
+}
+
+
 /* dump_cclp - same thing as list_character_set, but for cclps.  */
 
 static void    dump_cclp (FILE* file, int cclp)
@@ -129,6 +285,38 @@ ccl_set_diff (int a, int b)
     /* create new class  */
     d = cclinit();
 
+	if (utf8) {
+		int    *ra, *rb;
+		int     na, nb, i, j, lo;
+
+		/* Walk the ranges of a, cutting out the ranges of b. */
+		na = ccl_ranges (a, &ra);
+		nb = ccl_ranges (b, &rb);
+
+		for (i = 0, j = 0; i < na; ++i) {
+			lo = ra[2 * i];
+
+			while (j < nb && rb[2 * j + 1] < lo)
+				++j;
+
+			while (j < nb && rb[2 * j] <= ra[2 * i + 1]) {
+				if (rb[2 * j] > lo)
+					ccladd_range (d, lo, rb[2 * j] - 1);
+				lo = rb[2 * j + 1] + 1;
+				if (rb[2 * j + 1] > ra[2 * i + 1])
+					break;
+				++j;
+			}
+
+			if (lo <= ra[2 * i + 1])
+				ccladd_range (d, lo, ra[2 * i + 1]);
+		}
+
+		flex_free ((void *) ra);
+		flex_free ((void *) rb);
+		return d;
+	}
+
     /* In order to handle negation, we spin through all possible chars,
      * addding each char in a that is not in b.
      * (This could be O(n^2), but n is small and bounded.)
@@ -160,6 +348,23 @@ ccl_set_union (int a, int b)
     /* create new class  */
     d = cclinit();
 
+	if (utf8) {
+		int    *r;
+		int     n;
+
+		n = ccl_ranges (a, &r);
+		for (i = 0; i < n; ++i)
+			ccladd_range (d, r[2 * i], r[2 * i + 1]);
+		flex_free ((void *) r);
+
+		n = ccl_ranges (b, &r);
+		for (i = 0; i < n; ++i)
+			ccladd_range (d, r[2 * i], r[2 * i + 1]);
+		flex_free ((void *) r);
+
+		return d;
+	}
+
     /* Add all of a */
     for (i = 0; i < ccllen[a]; ++i)
 		ccladd (d, ccltbl[cclmap[a] + i]);
@@ -197,6 +402,7 @@ int     cclinit ()
 		ccllen =
 			reallocate_integer_array (ccllen, current_maxccls);
 		cclng = reallocate_integer_array (cclng, current_maxccls);
+		cclrng = reallocate_integer_array (cclrng, current_maxccls);
 		ccl_has_nl =
 			reallocate_bool_array (ccl_has_nl,
 					       current_maxccls);
@@ -217,6 +423,7 @@ int     cclinit ()
 
 	ccllen[lastccl] = 0;
 	cclng[lastccl] = 0;	/* ccl's start out life un-negated */
+	cclrng[lastccl] = 0;
 	ccl_has_nl[lastccl] = false;
 
 	return lastccl;
@@ -306,5 +513,9 @@ int reverse_case (int c)
 /** Return true if c is uppercase or lowercase. */
 bool has_case (int c)
 {
+	/* With --utf8, only ASCII letters fold. */
+	if (utf8 && c >= 0x80)
+		return false;
+
 	return (isupper (c) || islower (c)) ? true : false;
 }
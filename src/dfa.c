@@ -32,14 +32,68 @@
 #include "flexdef.h"
 #include "tables.h"
 
+#if defined(HAVE_PTHREAD_H) && HAVE_LIBPTHREAD
+#include <pthread.h>
+#define DFA_THREADS 1
+#endif
+
+/* The number of DFA states expanded at a time when using several threads. */
+#define DFA_JOB_BATCH 512
+
 /* declare functions that have forward references */
 
 void dump_associated_rules PROTO ((FILE *, int));
 void dump_transitions PROTO ((FILE *, int[]));
+void minimize_dfa PROTO ((int **, int));
+void order_dfa_by_profile PROTO ((int **, int));
+void order_dfa_by_density PROTO ((int **, int));
 void sympartition PROTO ((int[], int, int[], int[]));
 int symfollowset PROTO ((int[], int, int, int[]));
 
 
+/* Existing DFA states are looked up by the hash of their NFA state sets:
+ * dfa_bucket[hashval & (num_dfa_buckets - 1)] is the last DFA state made
+ * in a bucket and dfa_chain[ds] the one made before ds.
+ */
+static int *dfa_bucket, *dfa_chain, num_dfa_buckets;
+
+static void rehash_dfas PROTO ((void));
+
+
+/* A DFA state's out-transitions, worked out before the states they lead
+ * to are numbered: the partition of the equivalence classes made by
+ * sympartition() and, for each class with out-transitions of its own,
+ * the epsilon closure of where they go.  The closure for class sym is
+ * at pool[where[sym]]: the number of NFA states, the number of accepting
+ * numbers and the hash value, followed by the NFA states and then the
+ * accepting numbers.
+ */
+struct dfa_job {
+	int     ds;
+	int     symlist[CSIZE + 1], duplist[CSIZE + 1], where[CSIZE + 1];
+	int    *pool, pool_size;
+};
+
+/* Each thread's space for expanding DFA states.  marks is a bitset of the
+ * NFA states reached so far by the closure being built.
+ */
+struct dfa_worker {
+	int    *nset, *stk, *accset;
+	unsigned int *marks;
+#ifdef DFA_THREADS
+	pthread_t thread;
+#endif
+};
+
+static struct dfa_job *dfa_jobs;
+static struct dfa_worker *dfa_workers;
+static int num_dfa_workers, num_dfa_jobs, next_dfa_job;
+
+#ifdef DFA_THREADS
+static pthread_mutex_t dfa_job_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+
 /* check_for_backing_up - check a DFA state for backing up
  *
  * synopsis
@@ -130,6 +184,73 @@ void check_trailing_context (nfa_states, num_states, accset, nacc)
 }
 
 
+/* check_for_skip_loop - check a DFA state for a skip loop
+ *
+ * synopsis
+ *     void check_for_skip_loop( int ds, int state[numecs] );
+ *
+ * ds is the number of the state to check and state[] is its out-transitions,
+ * indexed by equivalence class.  If at most SKIP_SET_SIZE characters take
+ * the scanner out of ds, the scanner can skip until it sees one of them;
+ * failing that, if at most SKIP_SET_SIZE characters keep it in ds, it can
+ * skip while it sees them.  Either way the characters are recorded in
+ * skipset[].  NUL always leaves, since it also marks the end of the buffer.
+ */
+
+void check_for_skip_loop (ds, state)
+     int ds;
+     int state[];
+{
+	int     exits[SKIP_SET_SIZE], stays[SKIP_SET_SIZE];
+	int     num_exits = 0, num_stays = 0;
+	register int c, i;
+
+	exits[num_exits++] = 0;
+
+	for (c = 1; c < csize; ++c) {
+		int     ec = useecs ? ABS (ecgroup[c]) : c;
+
+		if (state[ec] == ds) {
+			if (num_stays < SKIP_SET_SIZE)
+				stays[num_stays] = c;
+			++num_stays;
+		}
+
+		else {
+			if (num_exits < SKIP_SET_SIZE)
+				exits[num_exits] = c;
+			++num_exits;
+		}
+	}
+
+	/* A 7-bit scanner can't skip until it sees one of a few characters,
+	 * since it would run over characters it has no transitions for.
+	 */
+	if (num_exits <= SKIP_SET_SIZE && csize == CSIZE) {
+		skipmode[ds] = SKIP_UNTIL;
+
+		/* Pad the set by repeating a character. */
+		for (i = 0; i < SKIP_SET_SIZE; ++i)
+			skipset[ds * SKIP_SET_SIZE + i] =
+				exits[i < num_exits ? i : 0];
+	}
+
+	else if (num_stays > 0 && num_stays <= SKIP_SET_SIZE) {
+		skipmode[ds] = SKIP_WHILE;
+
+		for (i = 0; i < SKIP_SET_SIZE; ++i)
+			skipset[ds * SKIP_SET_SIZE + i] =
+				stays[i < num_stays ? i : 0];
+	}
+
+	else
+		skipmode[ds] = 0;
+
+	if (trace && skipmode[ds])
+		fprintf (stderr, _("state # %d has a skip loop\n"), ds);
+}
+
+
 /* dump_associated_rules - list the rules associated with a DFA state
  *
  * Goes through the set of NFA states associated with the DFA and
@@ -215,6 +336,26 @@ void dump_transitions (file, state)
 }
 
 
+/* nfa_state_hash - hash an NFA state number into its DFA state's hash
+ *
+ * The hash of a set of NFA states is the sum of the hashes of its members,
+ * so it doesn't depend on the order in which the closure finds them.  The
+ * members are scrambled first so that sets with equal sums of state
+ * numbers don't all collide.
+ */
+
+static unsigned int nfa_state_hash (int state)
+{
+	unsigned int h = (unsigned int) state * 0x9e3779b1u;
+
+	h ^= h >> 15;
+	h *= 0x85ebca77u;
+	h ^= h >> 13;
+
+	return h;
+}
+
+
 /* epsclosure - construct the epsilon closure of a set of ndfa states
  *
  * synopsis
@@ -239,7 +380,8 @@ int    *epsclosure (t, ns_addr, accset, nacc_addr, hv_addr)
      int    *t, *ns_addr, accset[], *nacc_addr, *hv_addr;
 {
 	register int stkpos, ns, tsp;
-	int     numstates = *ns_addr, nacc, hashval, transsym, nfaccnum;
+	int     numstates = *ns_addr, nacc, transsym, nfaccnum;
+	unsigned int hashval;
 	int     stkend, nstate;
 	static int did_stk_init = false, *stk;
 
@@ -279,7 +421,7 @@ do { \
 if ( ++numstates >= current_max_dfa_size ) \
 DO_REALLOCATION(); \
 t[numstates] = state; \
-hashval += state; \
+hashval += nfa_state_hash (state); \
 }while(0)
 
 #define STACK_STATE(state) \
@@ -307,7 +449,7 @@ ADD_STATE(state); \
 		if (!IS_MARKED (ns)) {
 			PUT_ON_STACK (ns);
 			CHECK_ACCEPT (ns);
-			hashval += ns;
+			hashval += nfa_state_hash (ns);
 		}
 	}
 
@@ -342,7 +484,7 @@ ADD_STATE(state); \
 	}
 
 	*ns_addr = numstates;
-	*hv_addr = hashval;
+	*hv_addr = (int) hashval;
 	*nacc_addr = nacc;
 
 	return t;
@@ -365,29 +507,777 @@ void increase_max_dfas ()
 	dss = reallocate_int_ptr_array (dss, current_max_dfas);
 	dfaacc = reallocate_dfaacc_union (dfaacc, current_max_dfas);
 
+	if (dfa_chain)
+		dfa_chain =
+			reallocate_integer_array (dfa_chain, current_max_dfas);
+
 	if (nultrans)
 		nultrans =
 			reallocate_integer_array (nultrans,
 						  current_max_dfas);
+
+	if (skipmode) {
+		skipmode =
+			reallocate_integer_array (skipmode,
+						  current_max_dfas);
+		skipset =
+			reallocate_integer_array (skipset,
+						  current_max_dfas *
+						  SKIP_SET_SIZE);
+	}
+}
+
+
+/* init_dfa_workers - set up for expanding DFA states
+ *
+ * Returns the number of states to expand at a time.
+ */
+
+static int init_dfa_workers ()
+{
+	int     i, max_jobs, words = (lastnfa >> 5) + 1;
+
+	num_dfa_workers = dfa_threads;
+	max_jobs = num_dfa_workers > 1 ? DFA_JOB_BATCH : 1;
+
+	dfa_workers = (struct dfa_worker *)
+		allocate_array (num_dfa_workers, sizeof (struct dfa_worker));
+
+	for (i = 0; i < num_dfa_workers; ++i) {
+		dfa_workers[i].nset =
+			allocate_integer_array (2 * lastnfa + 2);
+		dfa_workers[i].stk = allocate_integer_array (lastnfa + 2);
+		dfa_workers[i].accset =
+			allocate_integer_array ((num_rules + 1) * 2);
+		dfa_workers[i].marks = (unsigned int *)
+			allocate_array (words, sizeof (unsigned int));
+		memset (dfa_workers[i].marks, 0,
+			words * sizeof (unsigned int));
+	}
+
+	dfa_jobs = (struct dfa_job *)
+		allocate_array (max_jobs, sizeof (struct dfa_job));
+
+	for (i = 0; i < max_jobs; ++i) {
+		memset (dfa_jobs[i].symlist, 0, sizeof (dfa_jobs[i].symlist));
+		dfa_jobs[i].pool_size = 0;
+		dfa_jobs[i].pool = (int *) 0;
+	}
+
+	return max_jobs;
+}
+
+
+/* free_dfa_workers - release what init_dfa_workers() set up */
+
+static void free_dfa_workers ()
+{
+	int     i;
+
+	for (i = 0; i < num_dfa_workers; ++i) {
+		flex_free ((void *) dfa_workers[i].nset);
+		flex_free ((void *) dfa_workers[i].stk);
+		flex_free ((void *) dfa_workers[i].accset);
+		flex_free ((void *) dfa_workers[i].marks);
+	}
+
+	for (i = 0; i < (num_dfa_workers > 1 ? DFA_JOB_BATCH : 1); ++i)
+		if (dfa_jobs[i].pool)
+			flex_free ((void *) dfa_jobs[i].pool);
+
+	flex_free ((void *) dfa_workers);
+	flex_free ((void *) dfa_jobs);
+}
+
+
+/* dfa_closure - epsilon closure of a set of NFA states, for one worker
+ *
+ * synopsis
+ *    numstates = dfa_closure( struct dfa_worker *w, int numstates,
+ *			int *nacc_addr, int *hashval_addr );
+ *
+ * Works like epsclosure() on w->nset[1 .. numstates], collecting the
+ * accepting numbers in w->accset, but marks the states it reaches in the
+ * worker's own bitset rather than in trans1[], so that several workers
+ * can run at once.
+ */
+
+#define DFA_MARKED(w, s) ((w)->marks[(s) >> 5] & (1u << ((s) & 31)))
+#define DFA_MARK(w, s) ((w)->marks[(s) >> 5] |= (1u << ((s) & 31)))
+#define DFA_UNMARK(w, s) ((w)->marks[(s) >> 5] &= ~(1u << ((s) & 31)))
+
+static int dfa_closure (w, numstates, nacc_addr, hv_addr)
+     struct dfa_worker *w;
+     int     numstates, *nacc_addr, *hv_addr;
+{
+	int    *t = w->nset, *stk = w->stk;
+	int     stkpos, stkend = 0, nacc = 0, ns, tsp, i, pass;
+	unsigned int hashval = 0;
+
+	for (i = 1; i <= numstates; ++i) {
+		ns = t[i];
+
+		if (!DFA_MARKED (w, ns)) {
+			DFA_MARK (w, ns);
+			stk[++stkend] = ns;
+
+			if (accptnum[ns] != NIL)
+				w->accset[++nacc] = accptnum[ns];
+
+			hashval += nfa_state_hash (ns);
+		}
+	}
+
+	for (stkpos = 1; stkpos <= stkend; ++stkpos) {
+		ns = stk[stkpos];
+
+		if (transchar[ns] != SYM_EPSILON ||
+		    trans1[ns] == NO_TRANSITION)
+			continue;
+
+		for (pass = 0; pass < 2; ++pass) {
+			tsp = pass ? trans2[ns] : trans1[ns];
+
+			if (tsp == NO_TRANSITION || DFA_MARKED (w, tsp))
+				continue;
+
+			DFA_MARK (w, tsp);
+			stk[++stkend] = tsp;
+
+			if (accptnum[tsp] != NIL)
+				w->accset[++nacc] = accptnum[tsp];
+
+			if (accptnum[tsp] != NIL ||
+			    transchar[tsp] != SYM_EPSILON) {
+				t[++numstates] = tsp;
+				hashval += nfa_state_hash (tsp);
+			}
+		}
+	}
+
+	for (stkpos = 1; stkpos <= stkend; ++stkpos)
+		DFA_UNMARK (w, stk[stkpos]);
+
+	*nacc_addr = nacc;
+	*hv_addr = (int) hashval;
+
+	return numstates;
+}
+
+
+/* expand_dfa_state - work out the out-transitions of a DFA state */
+
+static void expand_dfa_state (w, job)
+     struct dfa_worker *w;
+     struct dfa_job *job;
+{
+	int    *dset = dss[job->ds], dsize = dfasiz[job->ds];
+	int     sym, numstates, nacc, hashval, used = 0, *closure;
+
+	sympartition (dset, dsize, job->symlist, job->duplist);
+
+	for (sym = 1; sym <= numecs; ++sym) {
+		if (!job->symlist[sym] || job->duplist[sym] != NIL)
+			continue;
+
+		numstates = symfollowset (dset, dsize, sym, w->nset);
+		numstates = dfa_closure (w, numstates, &nacc, &hashval);
+
+		if (used + 3 + numstates + nacc > job->pool_size) {
+			job->pool_size = 2 * (used + 3 + numstates + nacc);
+			job->pool = job->pool ?
+				reallocate_integer_array (job->pool,
+							  job->pool_size) :
+				allocate_integer_array (job->pool_size);
+		}
+
+		job->where[sym] = used;
+		closure = job->pool + used;
+		closure[0] = numstates;
+		closure[1] = nacc;
+		closure[2] = hashval;
+		memcpy (closure + 3, w->nset + 1, numstates * sizeof (int));
+		memcpy (closure + 3 + numstates, w->accset + 1,
+			nacc * sizeof (int));
+
+		used += 3 + numstates + nacc;
+	}
+}
+
+
+#ifdef DFA_THREADS
+/* expand_dfa_thread - expand DFA states until the batch runs out */
+
+static void *expand_dfa_thread (arg)
+     void   *arg;
+{
+	struct dfa_worker *w = (struct dfa_worker *) arg;
+	int     i;
+
+	for (;;) {
+		pthread_mutex_lock (&dfa_job_lock);
+		i = next_dfa_job++;
+		pthread_mutex_unlock (&dfa_job_lock);
+
+		if (i >= num_dfa_jobs)
+			break;
+
+		expand_dfa_state (w, &dfa_jobs[i]);
+	}
+
+	return (void *) 0;
+}
+#endif
+
+
+/* expand_dfa_states - expand DFA states first_ds .. first_ds + num - 1
+ *
+ * The results go in dfa_jobs[0 .. num - 1].  Only the NFA and the DFA
+ * states' NFA sets are read while doing so, so the states can be split
+ * between threads.
+ */
+
+static void expand_dfa_states (first_ds, num)
+     int     first_ds, num;
+{
+	int     i;
+
+	for (i = 0; i < num; ++i)
+		dfa_jobs[i].ds = first_ds + i;
+
+	num_dfa_jobs = num;
+	next_dfa_job = 0;
+
+#ifdef DFA_THREADS
+	if (num_dfa_workers > 1 && num > 1) {
+		int     num_threads = MIN (num_dfa_workers, num);
+
+		for (i = 0; i < num_threads; ++i)
+			if (pthread_create (&dfa_workers[i].thread,
+					    (pthread_attr_t *) 0,
+					    expand_dfa_thread,
+					    (void *) &dfa_workers[i]))
+				flexfatal (_("could not create thread"));
+
+		for (i = 0; i < num_threads; ++i)
+			pthread_join (dfa_workers[i].thread, (void **) 0);
+
+		return;
+	}
+#endif
+
+	for (i = 0; i < num; ++i)
+		expand_dfa_state (&dfa_workers[0], &dfa_jobs[i]);
+}
+
+
+/* acccmp - compares the accepting sets of two DFA states
+ *
+ * Returns zero if the states accept the same rules.
+ */
+
+static int acccmp (int s1, int s2)
+{
+	int     i;
+
+	if (!reject)
+		return dfaacc[s1].dfaacc_state - dfaacc[s2].dfaacc_state;
+
+	if (accsiz[s1] != accsiz[s2])
+		return accsiz[s1] - accsiz[s2];
+
+	for (i = 1; i <= accsiz[s1]; ++i)
+		if (dfaacc[s1].dfaacc_set[i] != dfaacc[s2].dfaacc_set[i])
+			return dfaacc[s1].dfaacc_set[i] -
+				dfaacc[s2].dfaacc_set[i];
+
+	return 0;
+}
+
+
+/* accstatecmp - orders DFA states by accepting set for use by qsort */
+
+static int accstatecmp (const void *a, const void *b)
+{
+	int     s1 = *(const int *) a, s2 = *(const int *) b;
+	int     diff = acccmp (s1, s2);
+
+	return diff ? diff : s1 - s2;
+}
+
+
+/* minimize_dfa - merge equivalent DFA states
+ *
+ * synopsis
+ *    void minimize_dfa( int *rows[lastdfa + 1], int num_start_states );
+ *
+ * rows[ds][1 .. numecs] holds the out-transitions of DFA state ds, with
+ * 0 for a jam.  Two states are equivalent if they accept the same rules
+ * (with REJECT, the same accepting sets, trailing context marks
+ * included) and go to equivalent states on every equivalence class.
+ * The start states (and the end-of-buffer state) are never merged,
+ * since the scanner computes their numbers.  The classes of equivalent
+ * states are found by Hopcroft's partition refinement; each is then
+ * replaced by its lowest-numbered member and the survivors renumbered
+ * in order, so the start states keep their numbers.  lastdfa and the
+ * DFA state arrays are updated to match.
+ */
+
+void minimize_dfa (rows, num_start_states)
+     int   **rows, num_start_states;
+{
+	int    *elems, *loc, *blk, *first, *past, *mid, *work, *touched;
+	int    *predidx, *preds, *predsym, *cursor, *symidx, *splitters;
+	int    *newnum;
+	int     nstates = lastdfa, num_blocks, num_work, num_touched;
+	int     num_edges, s, t, b, nb, i, j, p, q, sym, kept;
+
+	if (nstates <= num_start_states + 1)
+		return;
+
+	elems = allocate_integer_array (nstates);
+	loc = allocate_integer_array (nstates + 1);
+	blk = allocate_integer_array (nstates + 1);
+	first = allocate_integer_array (nstates);
+	past = allocate_integer_array (nstates);
+	mid = allocate_integer_array (nstates);
+	work = allocate_integer_array (nstates);
+	touched = allocate_integer_array (nstates);
+
+	/* The partition is kept in elems[], each block occupying the
+	 * positions first[b] .. past[b] - 1.  The start states each get
+	 * a block of their own; the rest are grouped by what they accept.
+	 */
+	for (i = 0; i < nstates; ++i)
+		elems[i] = i + 1;
+
+	qsort (&elems[num_start_states], nstates - num_start_states,
+	       sizeof (elems[0]), accstatecmp);
+
+	num_blocks = 0;
+
+	for (i = 0; i < nstates; ++i) {
+		s = elems[i];
+
+		if (i < num_start_states + 1 ||
+		    acccmp (elems[i - 1], s) != 0) {
+			if (num_blocks > 0)
+				past[num_blocks - 1] = i;
+
+			first[num_blocks] = mid[num_blocks] = i;
+			++num_blocks;
+		}
+
+		loc[s] = i;
+		blk[s] = num_blocks - 1;
+	}
+
+	past[num_blocks - 1] = nstates;
+
+	/* Invert the transitions: the predecessors of state t are
+	 * preds[predidx[t] .. predidx[t + 1] - 1], reached on the
+	 * equivalence classes in predsym[].  Transitions to the jam state
+	 * are left out; it's in a block of its own that never needs to be
+	 * used as a splitter.
+	 */
+	predidx = allocate_integer_array (nstates + 2);
+	cursor = allocate_integer_array (MAX (nstates, numecs) + 2);
+	symidx = allocate_integer_array (numecs + 2);
+
+	for (t = 0; t <= nstates + 1; ++t)
+		predidx[t] = 0;
+
+	for (s = 1; s <= nstates; ++s)
+		for (sym = 1; sym <= numecs; ++sym)
+			if ((t = rows[s][sym]) != 0)
+				++predidx[t + 1];
+
+	for (t = 1; t <= nstates + 1; ++t)
+		predidx[t] += predidx[t - 1];
+
+	num_edges = predidx[nstates + 1];
+	preds = allocate_integer_array (MAX (num_edges, 1));
+	predsym = allocate_integer_array (MAX (num_edges, 1));
+	splitters = allocate_integer_array (MAX (num_edges, 1));
+
+	for (t = 0; t <= nstates; ++t)
+		cursor[t] = predidx[t];
+
+	for (s = 1; s <= nstates; ++s)
+		for (sym = 1; sym <= numecs; ++sym)
+			if ((t = rows[s][sym]) != 0) {
+				preds[cursor[t]] = s;
+				predsym[cursor[t]++] = sym;
+			}
+
+	/* Every block starts out as a splitter.  When a block is split,
+	 * the smaller half is added; if the block was itself still waiting
+	 * to be used, that's the same as adding both halves.
+	 */
+	for (b = 0; b < num_blocks; ++b)
+		work[b] = b;
+
+	num_work = num_blocks;
+
+	while (num_work > 0) {
+		b = work[--num_work];
+
+		/* Gather the predecessors of b's states by equivalence
+		 * class.
+		 */
+		for (sym = 0; sym <= numecs + 1; ++sym)
+			symidx[sym] = 0;
+
+		for (p = first[b]; p < past[b]; ++p) {
+			t = elems[p];
+
+			for (j = predidx[t]; j < predidx[t + 1]; ++j)
+				++symidx[predsym[j] + 1];
+		}
+
+		for (sym = 1; sym <= numecs + 1; ++sym)
+			symidx[sym] += symidx[sym - 1];
+
+		for (sym = 0; sym <= numecs; ++sym)
+			cursor[sym] = symidx[sym];
+
+		for (p = first[b]; p < past[b]; ++p) {
+			t = elems[p];
+
+			for (j = predidx[t]; j < predidx[t + 1]; ++j)
+				splitters[cursor[predsym[j]]++] = preds[j];
+		}
+
+		for (sym = 1; sym <= numecs; ++sym) {
+			num_touched = 0;
+
+			/* Move the states that go to b on sym to the front
+			 * of their blocks.
+			 */
+			for (j = symidx[sym]; j < symidx[sym + 1]; ++j) {
+				s = splitters[j];
+				nb = blk[s];
+
+				if (mid[nb] == first[nb])
+					touched[num_touched++] = nb;
+
+				p = loc[s];
+				q = mid[nb]++;
+				elems[p] = elems[q];
+				loc[elems[p]] = p;
+				elems[q] = s;
+				loc[s] = q;
+			}
+
+			/* Split the blocks that were only partly moved,
+			 * giving the smaller part a new block.
+			 */
+			for (i = 0; i < num_touched; ++i) {
+				t = touched[i];
+
+				if (mid[t] == past[t]) {
+					mid[t] = first[t];
+					continue;
+				}
+
+				nb = num_blocks++;
+
+				if (mid[t] - first[t] <= past[t] - mid[t]) {
+					first[nb] = first[t];
+					past[nb] = mid[t];
+					first[t] = mid[t];
+				}
+
+				else {
+					first[nb] = mid[t];
+					past[nb] = past[t];
+					past[t] = mid[t];
+				}
+
+				mid[t] = first[t];
+				mid[nb] = first[nb];
+
+				for (p = first[nb]; p < past[nb]; ++p)
+					blk[elems[p]] = nb;
+
+				work[num_work++] = nb;
+			}
+		}
+	}
+
+	if (num_blocks < nstates) {
+		/* Number the blocks in order of their lowest-numbered
+		 * states, which stand in for the rest.
+		 */
+		newnum = allocate_integer_array (nstates + 1);
+
+		for (b = 0; b < num_blocks; ++b)
+			mid[b] = 0;
+
+		kept = 0;
+		newnum[0] = 0;
+
+		for (s = 1; s <= nstates; ++s) {
+			b = blk[s];
+
+			if (!mid[b])
+				mid[b] = ++kept;
+
+			newnum[s] = mid[b];
+		}
+
+		kept = 0;
+
+		for (s = 1; s <= nstates; ++s) {
+			if (newnum[s] > kept) {
+				kept = newnum[s];
+
+				for (sym = 1; sym <= numecs; ++sym)
+					rows[s][sym] = newnum[rows[s][sym]];
+
+				rows[kept] = rows[s];
+				dss[kept] = dss[s];
+				dfasiz[kept] = dfasiz[s];
+				dfaacc[kept] = dfaacc[s];
+				accsiz[kept] = accsiz[s];
+				dhash[kept] = dhash[s];
+			}
+
+			else {
+				numas -= accsiz[s];
+				totnst -= dfasiz[s];
+
+				if (reject && dfaacc[s].dfaacc_set)
+					flex_free ((void *) dfaacc[s].
+						   dfaacc_set);
+
+				flex_free ((void *) dss[s]);
+				flex_free ((void *) rows[s]);
+			}
+		}
+
+		if (trace)
+			fprintf (stderr,
+				 _("\n%d equivalent DFA states merged\n\n"),
+				 nstates - kept);
+
+		nummerged = nstates - kept;
+		lastdfa = kept;
+
+		flex_free ((void *) newnum);
+	}
+
+	flex_free ((void *) elems);
+	flex_free ((void *) loc);
+	flex_free ((void *) blk);
+	flex_free ((void *) first);
+	flex_free ((void *) past);
+	flex_free ((void *) mid);
+	flex_free ((void *) work);
+	flex_free ((void *) touched);
+	flex_free ((void *) predidx);
+	flex_free ((void *) cursor);
+	flex_free ((void *) symidx);
+	flex_free ((void *) preds);
+	flex_free ((void *) predsym);
+	flex_free ((void *) splitters);
+}
+
+
+/* The weights order_dfa() sorts the states by. */
+static unsigned long *state_weight;
+
+/* weightcmp - orders DFA states by decreasing weight, for qsort */
+
+static int weightcmp (const void *a, const void *b)
+{
+	int     s1 = *(const int *) a, s2 = *(const int *) b;
+
+	if (state_weight[s1] != state_weight[s2])
+		return state_weight[s1] > state_weight[s2] ? -1 : 1;
+
+	return s1 - s2;
+}
+
+
+/* order_dfa - renumber DFA states by decreasing state_weight
+ *
+ * synopsis
+ *    void order_dfa( int *rows[lastdfa + 1], int num_start_states );
+ *
+ * The start states keep their numbers; the rest are renumbered so the
+ * heaviest come first.  The tables are built in state order, so those
+ * states' rows end up together at the front of them.
+ */
+
+static void order_dfa (rows, num_start_states)
+     int   **rows, num_start_states;
+{
+	int   **oldrows, **olddss, *olddfasiz, *oldaccsiz, *olddhash;
+	union dfaacc_union *olddfaacc;
+	int    *order, *newnum;
+	int     s, sym, i;
+
+	order = allocate_integer_array (lastdfa + 1);
+	newnum = allocate_integer_array (lastdfa + 1);
+
+	for (s = 0; s <= lastdfa; ++s)
+		order[s] = newnum[s] = s;
+
+	qsort (&order[num_start_states + 1], lastdfa - num_start_states,
+	       sizeof (order[0]), weightcmp);
+
+	for (i = num_start_states + 1; i <= lastdfa; ++i)
+		newnum[order[i]] = i;
+
+	oldrows = allocate_int_ptr_array (lastdfa + 1);
+	olddss = allocate_int_ptr_array (lastdfa + 1);
+	olddfasiz = allocate_integer_array (lastdfa + 1);
+	olddfaacc = allocate_dfaacc_union (lastdfa + 1);
+	oldaccsiz = allocate_integer_array (lastdfa + 1);
+	olddhash = allocate_integer_array (lastdfa + 1);
+
+	for (s = 1; s <= lastdfa; ++s) {
+		for (sym = 1; sym <= numecs; ++sym)
+			rows[s][sym] = newnum[rows[s][sym]];
+
+		oldrows[s] = rows[s];
+		olddss[s] = dss[s];
+		olddfasiz[s] = dfasiz[s];
+		olddfaacc[s] = dfaacc[s];
+		oldaccsiz[s] = accsiz[s];
+		olddhash[s] = dhash[s];
+	}
+
+	for (s = 1; s <= lastdfa; ++s) {
+		i = newnum[s];
+		rows[i] = oldrows[s];
+		dss[i] = olddss[s];
+		dfasiz[i] = olddfasiz[s];
+		dfaacc[i] = olddfaacc[s];
+		accsiz[i] = oldaccsiz[s];
+		dhash[i] = olddhash[s];
+	}
+
+	flex_free ((void *) order);
+	flex_free ((void *) newnum);
+	flex_free ((void *) oldrows);
+	flex_free ((void *) olddss);
+	flex_free ((void *) olddfasiz);
+	flex_free ((void *) olddfaacc);
+	flex_free ((void *) oldaccsiz);
+	flex_free ((void *) olddhash);
+}
+
+
+/* order_dfa_by_profile - renumber DFA states by how often they're visited
+ *
+ * synopsis
+ *    void order_dfa_by_profile( int *rows[lastdfa + 1],
+ *				 int num_start_states );
+ *
+ * Reads the counts a --profile-gen scanner wrote to profile_use_file and
+ * renumbers all but the start states so the most visited come first.
+ * The counts are for the states as minimize_dfa() leaves them, so a
+ * profile of a scanner with a different number of states or equivalence
+ * classes is ignored.
+ */
+
+void order_dfa_by_profile (rows, num_start_states)
+     int   **rows, num_start_states;
+{
+	FILE   *f;
+	int     nstates, necs, s;
+
+	if ((f = fopen (profile_use_file, "r")) == NULL)
+		lerrsf (_("can't open %s"), profile_use_file);
+
+	if (fscanf (f, "flex-profile %d %d", &nstates, &necs) != 2)
+		lerrsf (_("%s is not a flex profile"), profile_use_file);
+
+	if (nstates != lastdfa || necs != numecs) {
+		format_warn (_("profile %s is for a different scanner; ignoring it"),
+			     profile_use_file);
+		fclose (f);
+		return;
+	}
+
+	state_weight = (unsigned long *)
+		allocate_array (lastdfa + 1, sizeof (unsigned long));
+
+	for (s = 1; s <= lastdfa; ++s)
+		if (fscanf (f, "%lu", &state_weight[s]) != 1)
+			lerrsf (_("profile %s is truncated"), profile_use_file);
+
+	fclose (f);
+
+	order_dfa (rows, num_start_states);
+
+	if (trace)
+		fprintf (stderr, _("\nDFA states ordered by %s\n\n"),
+			 profile_use_file);
+
+	flex_free ((void *) state_weight);
+	state_weight = (unsigned long *) 0;
+}
+
+
+/* order_dfa_by_density - renumber DFA states by how many transitions
+ * they have
+ *
+ * synopsis
+ *    void order_dfa_by_density( int *rows[lastdfa + 1],
+ *				 int num_start_states );
+ *
+ * Without --profile-gen or --profile-use, --hybrid gives full rows to the
+ * states with the most out-transitions, which are the ones the comb packs
+ * worst and whose lookups most often walk the yy_def chain.
+ */
+
+void order_dfa_by_density (rows, num_start_states)
+     int   **rows, num_start_states;
+{
+	int     s, sym;
+
+	state_weight = (unsigned long *)
+		allocate_array (lastdfa + 1, sizeof (unsigned long));
+
+	for (s = 1; s <= lastdfa; ++s) {
+		state_weight[s] = 0;
+
+		for (sym = 1; sym <= numecs; ++sym)
+			if (rows[s][sym])
+				++state_weight[s];
+	}
+
+	order_dfa (rows, num_start_states);
+
+	flex_free ((void *) state_weight);
+	state_weight = (unsigned long *) 0;
 }
 
 
 /* ntod - convert an ndfa to a dfa
  *
  * Creates the dfa corresponding to the ndfa we've constructed.  The
- * dfa starts out in state #1.
+ * dfa starts out in state #1.  Equivalent states are merged before the
+ * tables are built, and with --profile-use the states are then put in
+ * order of how often they're visited (with --hybrid and neither
+ * --profile-gen nor --profile-use, in order of how many transitions
+ * they have).
  */
 
 void ntod ()
 {
 	int    *accset, ds, nacc, newds;
-	int     sym, hashval, numstates, dsize;
+	int     sym, hashval, numstates;
 	int     num_full_table_rows=0;	/* used only for -f */
-	int    *nset, *dset;
+	int    *nset, *closure, *cset, *cacc;
 	int     targptr, totaltrans, i, comstate, comfreq, targ;
-	int     symlist[CSIZE + 1];
 	int     num_start_states;
-	int     todo_head, todo_next;
+	int     todo_head, todo_next, first_job, num_jobs, max_jobs;
+	struct dfa_job *job;
+	int   **rows, num_rows, *targpos;
 
 	struct yytbl_data *yynxt_tbl = 0;
 	flex_int32_t *yynxt_data = 0, yynxt_curr = 0;
@@ -399,7 +1289,7 @@ void ntod ()
 	 * equivalence class) these arrays must have room for indices
 	 * from 1 to CSIZE, so their size must be CSIZE + 1.
 	 */
-	int     duplist[CSIZE + 1], state[CSIZE + 1];
+	int     state[CSIZE + 1];
 	int     targfreq[CSIZE + 1], targstate[CSIZE + 1];
 
 	/* accset needs to be large enough to hold all of the rules present
@@ -407,6 +1297,8 @@ void ntod ()
 	 */
 	accset = allocate_integer_array ((num_rules + 1) * 2);
 	nset = allocate_integer_array (current_max_dfa_size);
+	num_rows = current_max_dfas;
+	rows = allocate_int_ptr_array (num_rows);
 
 	/* The "todo" queue is represented by the head, which is the DFA
 	 * state currently being processed, and the "next", which is the
@@ -416,11 +1308,6 @@ void ntod ()
 	 */
 	todo_head = todo_next = 0;
 
-	for (i = 0; i <= csize; ++i) {
-		duplist[i] = NIL;
-		symlist[i] = false;
-	}
-
 	for (i = 0; i <= num_rules; ++i)
 		accset[i] = NIL;
 
@@ -492,6 +1379,13 @@ void ntod ()
 		 */
 	}
 
+	if (skip_loops) {
+		skipmode = allocate_integer_array (current_max_dfas);
+		skipset =
+			allocate_integer_array (current_max_dfas *
+						SKIP_SET_SIZE);
+	}
+
 
 	if (fullspd) {
 		for (i = 0; i <= numecs; ++i)
@@ -534,18 +1428,18 @@ void ntod ()
 					    sizeof (flex_int32_t));
 		yynxt_curr = 0;
 
-		buf_prints (&yydmap_buf,
-			    "\t{YYTD_ID_NXT, (void**)&yy_nxt, sizeof(%s)},\n",
-			    long_align ? "flex_int32_t" : "flex_int16_t");
+		yytbl_dmap_add (YYTD_ID_NXT, "yy_nxt",
+				long_align ? "flex_int32_t" : "flex_int16_t");
 
 		/* Unless -Ca, declare it "short" because it's a real
 		 * long-shot that that won't be large enough.
 		 */
-		if (gentables)
-			out_str_dec
-				("static yyconst %s yy_nxt[][%d] =\n    {\n",
-				 long_align ? "flex_int32_t" : "flex_int16_t",
-				 num_full_table_rows);
+		if (gentables) {
+			table_begin (long_align ? "flex_int32_t" :
+				     "flex_int16_t", "yy_nxt", 0,
+				     num_full_table_rows);
+			outn ("    {");
+		}
 		else {
 			out_dec ("#undef YY_NXT_LOLEN\n#define YY_NXT_LOLEN (%d)\n", num_full_table_rows);
 			out_str ("static yyconst %s *yy_nxt =0;\n",
@@ -567,6 +1461,8 @@ void ntod ()
 			outn ("    },\n");
 	}
 
+	rehash_dfas ();
+
 	/* Create the first states. */
 
 	num_start_states = lastsc * 2;
@@ -609,8 +1505,10 @@ void ntod ()
 	}
 
 
+	max_jobs = init_dfa_workers ();
+	first_job = num_jobs = 0;
+
 	while (todo_head < todo_next) {
-		targptr = 0;
 		totaltrans = 0;
 
 		for (i = 1; i <= numecs; ++i)
@@ -618,30 +1516,37 @@ void ntod ()
 
 		ds = ++todo_head;
 
-		dset = dss[ds];
-		dsize = dfasiz[ds];
+		if (ds >= first_job + num_jobs) {
+			/* Expand the next batch of states, perhaps on
+			 * several threads.  The states they lead to are
+			 * still numbered below, one at a time, in the
+			 * order in which they're reached.
+			 */
+			first_job = ds;
+			num_jobs = MIN (todo_next - todo_head + 1, max_jobs);
+			expand_dfa_states (first_job, num_jobs);
+		}
+
+		job = &dfa_jobs[ds - first_job];
 
 		if (trace)
 			fprintf (stderr, _("state # %d:\n"), ds);
 
-		sympartition (dset, dsize, symlist, duplist);
-
 		for (sym = 1; sym <= numecs; ++sym) {
-			if (symlist[sym]) {
-				symlist[sym] = 0;
+			if (job->symlist[sym]) {
+				job->symlist[sym] = 0;
 
-				if (duplist[sym] == NIL) {
+				if (job->duplist[sym] == NIL) {
 					/* Symbol has unique out-transitions. */
-					numstates =
-						symfollowset (dset, dsize,
-							      sym, nset);
-					nset = epsclosure (nset,
-							   &numstates,
-							   accset, &nacc,
-							   &hashval);
+					closure = job->pool + job->where[sym];
+					numstates = closure[0];
+					nacc = closure[1];
+					hashval = closure[2];
+					cset = closure + 2;
+					cacc = cset + numstates;
 
 					if (snstods
-					    (nset, numstates, accset, nacc,
+					    (cset, numstates, cacc, nacc,
 					     hashval, &newds)) {
 						totnst = totnst +
 							numstates;
@@ -650,9 +1555,9 @@ void ntod ()
 
 						if (variable_trailing_context_rules && nacc > 0)
 							check_trailing_context
-								(nset,
+								(cset,
 								 numstates,
-								 accset,
+								 cacc,
 								 nacc);
 					}
 
@@ -663,8 +1568,6 @@ void ntod ()
 							 "\t%d\t%d\n", sym,
 							 newds);
 
-					targfreq[++targptr] = 1;
-					targstate[targptr] = newds;
 					++numuniq;
 				}
 
@@ -673,7 +1576,7 @@ void ntod ()
 					 * transitions as duplist(sym)'s
 					 * equivalence class.
 					 */
-					targ = state[duplist[sym]];
+					targ = state[job->duplist[sym]];
 					state[sym] = targ;
 
 					if (trace)
@@ -681,28 +1584,90 @@ void ntod ()
 							 "\t%d\t%d\n", sym,
 							 targ);
 
-					/* Update frequency count for
-					 * destination state.
-					 */
-
-					i = 0;
-					while (targstate[++i] != targ) ;
-
-					++targfreq[i];
 					++numdup;
 				}
 
 				++totaltrans;
-				duplist[sym] = NIL;
 			}
 		}
 
 
 		numsnpairs += totaltrans;
 
+		/* Save the transitions; the tables are built once the
+		 * DFA has been minimized.
+		 */
+		if (ds >= num_rows) {
+			num_rows = current_max_dfas;
+			rows = reallocate_int_ptr_array (rows, num_rows);
+		}
+
+		rows[ds] = allocate_integer_array (numecs + 1);
+
+		for (i = 1; i <= numecs; ++i)
+			rows[ds][i] = state[i];
+	}
+
+	free_dfa_workers ();
+
+	/* No more states will be looked up; minimize_dfa() renumbers them. */
+	flex_free ((void *) dfa_bucket);
+	flex_free ((void *) dfa_chain);
+	dfa_bucket = dfa_chain = (int *) 0;
+
+	phase_mark (PHASE_MINIMIZE);
+
+	if (minimize)
+		minimize_dfa (rows, num_start_states);
+
+	/* A --profile-gen scanner counts the states as minimize_dfa()
+	 * leaves them, which is the order --profile-use reads the counts
+	 * in, so they mustn't be renumbered by density for --hybrid.
+	 */
+	if (profile_use_file)
+		order_dfa_by_profile (rows, num_start_states);
+	else if (hybrid_size > 0 && !profile_gen_file)
+		order_dfa_by_density (rows, num_start_states);
+
+	phase_mark (PHASE_COMPRESS);
+	targpos = allocate_integer_array (lastdfa + 1);
+
+	for (i = 0; i <= lastdfa; ++i)
+		targpos[i] = 0;
+
+	for (ds = 1; ds <= lastdfa; ++ds) {
+		targptr = 0;
+		totaltrans = 0;
+
+		/* Count the transitions to each destination state, in the
+		 * order in which they're first seen.
+		 */
+		for (i = 1; i <= numecs; ++i) {
+			state[i] = targ = rows[ds][i];
+
+			if (targ) {
+				if (!targpos[targ]) {
+					targpos[targ] = ++targptr;
+					targstate[targptr] = targ;
+					targfreq[targptr] = 0;
+				}
+
+				++targfreq[targpos[targ]];
+				++totaltrans;
+			}
+		}
+
+		for (i = 1; i <= targptr; ++i)
+			targpos[targstate[i]] = 0;
+
+		flex_free ((void *) rows[ds]);
+
 		if (ds > num_start_states)
 			check_for_backing_up (ds, state);
 
+		if (skipmode)
+			check_for_skip_loop (ds, state);
+
 		if (nultrans) {
 			nultrans[ds] = state[NUL_ec];
 			state[NUL_ec] = 0;	/* remove transition */
@@ -793,6 +1758,9 @@ void ntod ()
 	else if (!fullspd) {
 		cmptmps ();	/* create compressed template entries */
 
+		/* With -Cx, nothing's been placed yet; place it all now. */
+		pack_entries ();
+
 		/* Create tables for all the states with only one
 		 * out-transition.
 		 */
@@ -807,6 +1775,77 @@ void ntod ()
 
 	flex_free ((void *) accset);
 	flex_free ((void *) nset);
+	flex_free ((void *) rows);
+	flex_free ((void *) targpos);
+}
+
+
+/* mklazy - set up the start states for a scanner that builds its own DFA
+ *
+ * With --lazy-dfa the scanner does the subset construction itself, a state
+ * at a time as the input reaches it, so no DFA is built here.  All the
+ * scanner needs is the NFA state each start state's epsilon closure begins
+ * from, in the order ntod() numbers the start states.  The end-of-buffer
+ * state comes right after them and state 0 is the jam state.
+ */
+
+void mklazy ()
+{
+	int     i, num_start_states = lastsc * 2;
+
+	if (trace)
+		dumpnfa (scset[1]);
+
+	lazystart = allocate_integer_array (num_start_states + 1);
+
+	for (i = 1; i <= num_start_states; ++i)
+		if (i % 2 == 1)
+			lazystart[i] = scset[(i / 2) + 1];
+		else
+			lazystart[i] = mkbranch (scbol[i / 2], scset[i / 2]);
+
+	lastdfa = end_of_buffer_state = num_start_states + 1;
+	jamstate = 0;
+
+	/* Which rules can be matched isn't known until the scanner runs,
+	 * so don't warn about any of them.
+	 */
+	for (i = 1; i <= num_rules; ++i)
+		if (i != default_rule)
+			rule_useful[i] = true;
+}
+
+
+/* rehash_dfas - double the number of buckets in the DFA state index
+ *
+ * If there's no index yet, sets up an empty one.
+ */
+
+static void rehash_dfas ()
+{
+	int     ds, bucket;
+
+	if (!dfa_bucket) {
+		num_dfa_buckets = 256;
+		dfa_chain = allocate_integer_array (current_max_dfas);
+	}
+
+	else {
+		flex_free ((void *) dfa_bucket);
+		num_dfa_buckets *= 2;
+	}
+
+	dfa_bucket = allocate_integer_array (num_dfa_buckets);
+
+	for (bucket = 0; bucket < num_dfa_buckets; ++bucket)
+		dfa_bucket[bucket] = NIL;
+
+	for (ds = 1; ds <= lastdfa; ++ds) {
+		bucket = (int) ((unsigned int) dhash[ds] &
+				(num_dfa_buckets - 1));
+		dfa_chain[ds] = dfa_bucket[bucket];
+		dfa_bucket[bucket] = ds;
+	}
 }
 
 
@@ -825,9 +1864,11 @@ int snstods (sns, numstates, accset, nacc, hashval, newds_addr)
 {
 	int     didsort = 0;
 	register int i, j;
-	int     newds, *oldsns;
+	int     newds, *oldsns, bucket;
+
+	bucket = (int) ((unsigned int) hashval & (num_dfa_buckets - 1));
 
-	for (i = 1; i <= lastdfa; ++i)
+	for (i = dfa_bucket[bucket]; i != NIL; i = dfa_chain[i])
 		if (hashval == dhash[i]) {
 			if (numstates == dfasiz[i]) {
 				oldsns = dss[i];
@@ -879,6 +1920,12 @@ int snstods (sns, numstates, accset, nacc, hashval, newds_addr)
 	dfasiz[newds] = numstates;
 	dhash[newds] = hashval;
 
+	dfa_chain[newds] = dfa_bucket[bucket];
+	dfa_bucket[bucket] = newds;
+
+	if (lastdfa > 2 * num_dfa_buckets)
+		rehash_dfas ();
+
 	if (nacc == 0) {
 		if (reject)
 			dfaacc[newds].dfaacc_set = (int *) 0;
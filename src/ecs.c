@@ -118,7 +118,13 @@ void    mkeccl (ccls, lenccl, fwd, bck, llsiz, NUL_mapping)
 {
 	int     cclp, oldec, newec;
 	int     cclm, i, j;
-	static unsigned char cclflags[CSIZE];	/* initialized to all '\0' */
+	unsigned char cclflags[CSIZE];
+
+	/* cclflags isn't static so that ntod() can partition states on
+	 * several threads at once.
+	 */
+	for (cclp = 0; cclp < lenccl; ++cclp)
+		cclflags[cclp] = 0;
 
 	/* Note that it doesn't matter whether or not the character class is
 	 * negated.  The same results will be obtained in either case.
@@ -232,6 +232,44 @@ int filter_truncate (struct filter *chain, int max_len)
  *  The header file name is in extra.
  *  @return 0 (zero) on success, and -1 on failure.
  */
+/* What filter_tee_header puts before the output, in the C file or the
+ * header file.
+ */
+static void tee_head (FILE *to, bool header)
+{
+	fputs (check_4_gnu_m4, to);
+	fputs ("m4_changecom`'m4_dnl\n", to);
+	fputs ("m4_changequote`'m4_dnl\n", to);
+	fputs ("m4_changequote([[,]])[[]]m4_dnl\n", to);
+	fputs ("m4_define([[M4_YY_NOOP]])[[]]m4_dnl\n", to);
+
+	if (header) {
+		fputs ("m4_define( [[M4_YY_IN_HEADER]],[[]])m4_dnl\n", to);
+		fprintf (to, "#ifndef %sHEADER_H\n", prefix);
+		fprintf (to, "#define %sHEADER_H 1\n", prefix);
+		fprintf (to, "#define %sIN_HEADER 1\n\n", prefix);
+		fprintf (to,
+			 "m4_define( [[M4_YY_OUTFILE_NAME]],[[%s]])m4_dnl\n",
+			 headerfilename ? headerfilename : "<stdout>");
+	}
+	else
+		fprintf (to, "m4_define( [[M4_YY_OUTFILE_NAME]],[[%s]])m4_dnl\n",
+			 outfilename ? outfilename : "<stdout>");
+}
+
+/* What filter_tee_header puts after the output in the header file. */
+static void tee_tail (FILE *to_h)
+{
+	fprintf (to_h, "\n");
+
+	/* write a fake line number. It will get fixed by the linedir filter. */
+	fprintf (to_h, "#line 4000 \"M4_YY_OUTFILE_NAME\"\n");
+
+	fprintf (to_h, "#undef %sIN_HEADER\n", prefix);
+	fprintf (to_h, "#endif /* %sHEADER_H */\n", prefix);
+	fputs ("m4_undefine( [[M4_YY_IN_HEADER]])m4_dnl\n", to_h);
+}
+
 int filter_tee_header (struct filter *chain)
 {
 	/* This function reads from stdin and writes to both the C file and the
@@ -266,30 +304,10 @@ int filter_tee_header (struct filter *chain)
 	/* Now to_c is a pipe to the C branch, and to_h is a pipe to the H branch.
 	 */
 
-	if (write_header) {
-        fputs (check_4_gnu_m4, to_h);
-		fputs ("m4_changecom`'m4_dnl\n", to_h);
-		fputs ("m4_changequote`'m4_dnl\n", to_h);
-		fputs ("m4_changequote([[,]])[[]]m4_dnl\n", to_h);
-	    fputs ("m4_define([[M4_YY_NOOP]])[[]]m4_dnl\n", to_h);
-		fputs ("m4_define( [[M4_YY_IN_HEADER]],[[]])m4_dnl\n",
-		       to_h);
-		fprintf (to_h, "#ifndef %sHEADER_H\n", prefix);
-		fprintf (to_h, "#define %sHEADER_H 1\n", prefix);
-		fprintf (to_h, "#define %sIN_HEADER 1\n\n", prefix);
-		fprintf (to_h,
-			 "m4_define( [[M4_YY_OUTFILE_NAME]],[[%s]])m4_dnl\n",
-			 headerfilename ? headerfilename : "<stdout>");
-
-	}
+	if (write_header)
+		tee_head (to_h, true);
 
-    fputs (check_4_gnu_m4, to_c);
-	fputs ("m4_changecom`'m4_dnl\n", to_c);
-	fputs ("m4_changequote`'m4_dnl\n", to_c);
-	fputs ("m4_changequote([[,]])[[]]m4_dnl\n", to_c);
-	fputs ("m4_define([[M4_YY_NOOP]])[[]]m4_dnl\n", to_c);
-	fprintf (to_c, "m4_define( [[M4_YY_OUTFILE_NAME]],[[%s]])m4_dnl\n",
-		 outfilename ? outfilename : "<stdout>");
+	tee_head (to_c, false);
 
 	buf = (char *) flex_alloc (readsz);
 	if (!buf)
@@ -301,14 +319,7 @@ int filter_tee_header (struct filter *chain)
 	}
 
 	if (write_header) {
-		fprintf (to_h, "\n");
-
-		/* write a fake line number. It will get fixed by the linedir filter. */
-		fprintf (to_h, "#line 4000 \"M4_YY_OUTFILE_NAME\"\n");
-
-		fprintf (to_h, "#undef %sIN_HEADER\n", prefix);
-		fprintf (to_h, "#endif /* %sHEADER_H */\n", prefix);
-		fputs ("m4_undefine( [[M4_YY_IN_HEADER]])m4_dnl\n", to_h);
+		tee_tail (to_h);
 
 		fflush (to_h);
 		if (ferror (to_h))
@@ -441,4 +452,272 @@ int filter_fix_linedirs (struct filter *chain)
 	return 0;
 }
 
+/* The in-process path: flex's output goes to a temporary file and is
+ * expanded from there into the output file and the header, each through
+ * its own expander and the same #line fix-up as filter_fix_linedirs does.
+ */
+
+static FILE *capture_file;	/* flex's unexpanded output */
+static int capture_fd = -1;	/* where the output really goes */
+
+/* State of the #line fix-up for one output file. */
+struct linefix {
+	FILE   *out;
+	bool    fix;		/* false to pass the lines through as they are */
+	int     lineno;
+	bool    in_gen;		/* in generated code */
+	bool    last_was_blank;
+};
+
+static void linefix_emit PROTO ((void *, const char *, int));
+static void linefix_line PROTO ((struct linefix *, const char *, int));
+static bool linefix_linedir PROTO ((struct linefix *, const char *, int));
+static void expand_to PROTO ((FILE *, const char *, int, bool, bool,
+			      const char *));
+static void tee_to PROTO ((FILE *, const char *, int, bool));
+
+/** Send what flex writes to stdout to a temporary file, to be expanded by
+ *  filter_expand once the scanner has been written.
+ */
+void filter_capture ()
+{
+	fflush (stdout);
+
+	if ((capture_file = tmpfile ()) == NULL)
+		flexfatal (_("could not create temporary file"));
+
+	if ((capture_fd = dup (1)) == -1)
+		flexfatal (_("dup(1) failed"));
+
+	if (dup2 (fileno (capture_file), 1) == -1)
+		flexfatal (_("dup2(tmp,1) failed"));
+	fseek (stdout, 0, SEEK_CUR);
+}
+
+/** Expand the output captured by filter_capture into the output file and,
+ *  with a header file, into that as well.
+ *  @param level how far to take it, as the number of filters --external-m4
+ *         would run: 1 for the text as filter_tee_header writes it, 2 for it
+ *         expanded, 3 or more for the #line directives fixed up as well
+ */
+void filter_expand (int level)
+{
+	const char *outname = outfilename ? outfilename : "<stdout>";
+	char   *text;
+	long    len;
+	FILE   *to_c, *to_h;
+
+	if (!capture_file)
+		return;
+
+	fflush (stdout);
+	if (fseek (capture_file, 0, SEEK_END) != 0
+	    || (len = ftell (capture_file)) < 0)
+		flexfatal (_("could not read temporary file"));
+	rewind (capture_file);
+
+	text = (char *) flex_alloc (len + 1);
+	if (!text)
+		flexerror (_("flex_alloc failed in filter_expand"));
+	if ((long) fread (text, 1, len, capture_file) != len)
+		flexfatal (_("could not read temporary file"));
+
+	if ((to_c = fdopen (capture_fd, "w")) == NULL)
+		flexfatal (_("fdopen failed"));
+	capture_file = NULL;
+
+	if (level <= 1)
+		tee_to (to_c, text, (int) len, false);
+	else
+		expand_to (to_c, text, (int) len, false, level > 2, outname);
+
+	if (ferror (to_c))
+		lerrsf (_("error writing output file %s"), outname);
+
+	else if (fclose (to_c))
+		lerrsf (_("error closing output file %s"), outname);
+
+	if (headerfilename) {
+		if ((to_h = fopen (headerfilename, "w")) == NULL)
+			lerrsf (_("could not create %s"), headerfilename);
+
+		if (level <= 1)
+			tee_to (to_h, text, (int) len, true);
+		else
+			expand_to (to_h, text, (int) len, true, level > 2,
+				   headerfilename);
+
+		if (ferror (to_h))
+			lerrsf (_("error writing output file %s"),
+				headerfilename);
+
+		else if (fclose (to_h))
+			lerrsf (_("error closing output file %s"),
+				headerfilename);
+	}
+
+	flex_free (text);
+}
+
+/* Write text to out unexpanded, as filter_tee_header would. */
+static void tee_to (FILE *out, const char *text, int len, bool header)
+{
+	tee_head (out, header);
+	fwrite (text, 1, len, out);
+	if (header)
+		tee_tail (out);
+}
+
+/* Expand text into out.  The header is text set about with what
+ * filter_tee_header puts around it.  fix says whether to fix up the #line
+ * directives too.
+ */
+static void expand_to (FILE *out, const char *text, int len,
+		       bool header, bool fix, const char *name)
+{
+	struct linefix lf;
+	struct m4 *m;
+	char    head[MAXLINE], tail[MAXLINE];
+
+	lf.out = out;
+	lf.fix = fix;
+	lf.lineno = 1;
+	lf.in_gen = true;
+	lf.last_was_blank = false;
+
+	m = m4_create (linefix_emit, &lf);
+	m4_set_comments (m, "", "");
+	m4_set_quotes (m, "[[", "]]");
+	m4_define (m, "M4_YY_NOOP", "");
+	m4_define (m, "M4_YY_OUTFILE_NAME", name);
+
+	if (header) {
+		m4_define (m, "M4_YY_IN_HEADER", "");
+
+		/* The fake line number gets fixed like any other. */
+		snprintf (tail, sizeof (tail),
+			  "\n#line 4000 \"M4_YY_OUTFILE_NAME\"\n"
+			  "#undef %sIN_HEADER\n#endif /* %sHEADER_H */\n",
+			  prefix, prefix);
+		m4_push (m, tail, strlen (tail));
+	}
+
+	m4_push (m, text, len);
+
+	if (header) {
+		snprintf (head, sizeof (head),
+			  "#ifndef %sHEADER_H\n#define %sHEADER_H 1\n"
+			  "#define %sIN_HEADER 1\n\n", prefix, prefix, prefix);
+		m4_push (m, head, strlen (head));
+	}
+
+	m4_run (m);
+	m4_destroy (m);
+}
+
+/* Fix up the lines m4 has expanded, as they come. */
+static void linefix_emit (void *arg, const char *text, int len)
+{
+	struct linefix *lf = (struct linefix *) arg;
+	const char *nl;
+
+	while (len > 0) {
+		nl = (const char *) memchr (text, '\n', len);
+		nl = nl ? nl + 1 : text + len;
+		linefix_line (lf, text, nl - text);
+		len -= nl - text;
+		text = nl;
+	}
+}
+
+/* Write one line; see filter_fix_linedirs. */
+static void linefix_line (struct linefix *lf, const char *line, int len)
+{
+	int     i;
+
+	if (!lf->fix) {
+		fwrite (line, 1, len, lf->out);
+		return;
+	}
+
+	if (line[0] == '#' && linefix_linedir (lf, line, len)) {
+		lf->last_was_blank = false;
+		lf->lineno++;
+		return;
+	}
+
+	for (i = 0; i < len && isspace ((unsigned char) line[i]); ++i) ;
+
+	if (lf->in_gen && i == len) {
+		if (lf->last_was_blank)
+			return;
+		lf->last_was_blank = true;
+	}
+	else
+		lf->last_was_blank = false;
+
+	fwrite (line, 1, len, lf->out);
+	lf->lineno++;
+}
+
+/* If line is a #line directive, write it, with the line number fixed if
+ * it's for the output file or the header, and return true.
+ */
+static bool linefix_linedir (struct linefix *lf, const char *line, int len)
+{
+	const char *p = line + 6, *end = line + len, *q;
+	const char *outname = outfilename ? outfilename : "<stdout>";
+	const char *hname = headerfilename ? headerfilename : "<stdout>";
+	char    fname[MAXLINE], filename[MAXLINE];
+	char   *s2;
+	int     n;
+
+	if (len < 6 || strncmp (line, "#line ", 6) != 0)
+		return false;
+
+	for (q = p; q < end && isdigit ((unsigned char) *q); ++q) ;
+	if (q == p || end - q < 3 || q[0] != ' ' || q[1] != '"')
+		return false;
+
+	/* The file name runs to the line's last quote. */
+	p = q + 2;
+	for (q = end; q > p && q[-1] != '"'; --q) ;
+	if (q == p)
+		return false;
+
+	n = MIN (q - 1 - p, MAXLINE - 1);
+	memcpy (fname, p, n);
+	fname[n] = '\0';
+
+	if (strcmp (fname, outname) == 0 || strcmp (fname, hname) == 0) {
+		const char *s1 = fname;
+
+		s2 = filename;
+		while ((s2 - filename) < (MAXLINE - 1) && *s1) {
+			/* Escape the backslash */
+			if (*s1 == '\\')
+				*s2++ = '\\';
+			/* Escape the double quote */
+			if (*s1 == '\"')
+				*s2++ = '\\';
+			/* Copy the character as usual */
+			*s2++ = *s1++;
+		}
+
+		*s2 = '\0';
+
+		/* Adjust the line directives. */
+		lf->in_gen = true;
+		fprintf (lf->out, "#line %d \"%s\"\n", lf->lineno + 1,
+			 filename);
+	}
+	else {
+		/* it's a #line directive for code we didn't write */
+		lf->in_gen = false;
+		fwrite (line, 1, len, lf->out);
+	}
+
+	return true;
+}
+
 /* vim:set expandtab cindent tabstop=4 softtabstop=4 shiftwidth=4 textwidth=0: */
@@ -84,6 +84,12 @@ char *alloca ();
 #ifdef HAVE_SYS_WAIT_H
 #include <sys/wait.h>
 #endif
+#ifdef HAVE_SYS_TIME_H
+#include <sys/time.h>
+#endif
+#ifdef HAVE_SYS_RESOURCE_H
+#include <sys/resource.h>
+#endif
 #ifdef HAVE_STDBOOL_H
 #include <stdbool.h>
 #else
@@ -111,6 +117,10 @@ char *alloca ();
 #define CSIZE 256
 #define Char unsigned char
 
+/* The largest Unicode code point, and how many bytes UTF-8 takes for one. */
+#define UTF8_MAX 0x10ffff
+#define UTF8_LEN(c) ((c) < 0x80 ? 1 : (c) < 0x800 ? 2 : (c) < 0x10000 ? 3 : 4)
+
 /* Size of input alphabet - should be size of ASCII set. */
 #ifndef DEFAULT_CSIZE
 #define DEFAULT_CSIZE 128
@@ -234,6 +244,10 @@ char *alloca ();
 #define INITIAL_MAX_CCL_TBL_SIZE 500
 #define MAX_CCL_TBL_SIZE_INCREMENT 250
 
+/* Size of the tables holding --utf8 code point ranges. */
+#define INITIAL_MAX_RNGS 100
+#define MAX_RNGS_INCREMENT 100
+
 #define INITIAL_MAX_RULES 100	/* default maximum number of rules */
 #define MAX_RULES_INCREMENT 100
 
@@ -335,6 +349,14 @@ char *alloca ();
  */
 #define MAX_ASSOC_RULES 100
 
+/* Maximum number of characters that may leave (or, failing that, keep us
+ * in) a DFA state for it to get a skip loop with --skip-loops, and the
+ * two kinds of skip loop.
+ */
+#define SKIP_SET_SIZE 4
+#define SKIP_UNTIL 1		/* skip until one of the characters is seen */
+#define SKIP_WHILE 2		/* skip while one of the characters is seen */
+
 /* Number that, if used to subscript an array, has a good chance of producing
  * an error; should be small enough to fit into a short.
  */
@@ -351,12 +373,15 @@ char *alloca ();
 
 /* Variables for flags:
  * printstats - if true (-v), dump statistics
+ * stats_json - if true (--stats=json), report phase timings as JSON
  * syntaxerror - true if a syntax error has been found
  * eofseen - true if we've seen an eof in the input file
  * ddebug - if true (-d), make a "debug" scanner
  * trace - if true (-T), trace processing
  * nowarn - if true (-w), do not generate warnings
  * spprdflt - if true (-s), suppress the default rule
+ * external_m4 - if true (--external-m4), expand the output with the m4
+ *   program in a chain of filter processes rather than within flex
  * interactive - if true (-I), generate an interactive scanner
  * lex_compat - if true (-l), maximize compatibility with AT&T lex
  * posix_compat - if true (-X), maximize compatibility with POSIX lex
@@ -365,6 +390,10 @@ char *alloca ();
  * fulltbl - if true (-Cf flag), don't compress the DFA state table
  * usemecs - if true (-Cm flag), use meta-equivalence classes
  * fullspd - if true (-F flag), use Jacobson method of table representation
+ * directcode - if true (-Cg flag), match with a goto for each DFA transition
+ *   rather than walking the compressed tables
+ * packtbl - if true (-Cx flag), pack the compressed tables densest state
+ *   first instead of in state order
  * gen_line_dirs - if true (i.e., no -L flag), generate #line directives
  * performance_report - if > 0 (i.e., -p flag), generate a report relating
  *   to scanner performance; if > 1 (-p -p), report on minor performance
@@ -381,10 +410,33 @@ char *alloca ();
  *   otherwise, use fread().
  * yytext_is_array - if true (i.e., %array directive), then declare
  *   yytext as a array instead of a character pointer.  Nice and inefficient.
+ * zero_copy - if true (--zero-copy), never write into the input buffer, so
+ *   yytext is not NUL-terminated and the end of the buffer is found by position.
+ * read_ahead - if true (--readahead), call YY_INPUT from a helper thread that
+ *   stays a buffer's worth ahead of the scanner.
+ * token_batch - if true (--token-batch), also generate yylex_batch(), which
+ *   returns many tokens per call.
+ * push_scanner - if true (--push), input is handed to the scanner in chunks by
+ *   yylex_push() rather than read with YY_INPUT.
+ * parallel_scan - if true (--parallel), also generate yylex_parallel(), which
+ *   scans an input in memory on several threads.
+ * skip_loops - if true (--skip-loops), run through the input in a single
+ *   step while the DFA stays in a state that loops back to itself.
+ * lazy_dfa - if true (--lazy-dfa), ship the NFA and have the scanner build
+ *   the DFA states it needs as it goes.
+ * utf8 - if true (--utf8), patterns are in UTF-8 and match UTF-8 characters
+ *   rather than bytes.
+ * profile_counters - if true (%option profile), the scanner counts matches
+ *   per rule, backing up and buffer refills, for yyget_profile().
  * do_yywrap - do yywrap() processing on EOF.  If false, EOF treated as
  *   "no more files".
  * csize - size of character set for the scanner we're generating;
  *   128 for 7-bit chars and 256 for 8-bit
+ * dfa_threads - number of threads to build the DFA on (--dfa-threads)
+ * minimize - if true (the default), merge equivalent DFA states before
+ *   building the tables; --nominimize turns it off
+ * hybrid_size - with --hybrid, how many bytes of full rows the compressed
+ *   tables may add for their busiest states; 0 if none
  * yymore_used - if true, yymore() is used in input rules
  * reject - if true, generate back-up tables for REJECT macro
  * real_reject - if true, scanner really uses REJECT (as opposed to just
@@ -397,15 +449,17 @@ char *alloca ();
  * reject_really_used - same for REJECT
  */
 
-extern int printstats, syntaxerror, eofseen, ddebug, trace, nowarn,
-	spprdflt;
+extern int printstats, stats_json, syntaxerror, eofseen, ddebug, trace,
+	nowarn, spprdflt, external_m4;
 extern int interactive, lex_compat, posix_compat, do_yylineno;
-extern int useecs, fulltbl, usemecs, fullspd;
+extern int useecs, fulltbl, usemecs, fullspd, directcode, packtbl;
 extern int gen_line_dirs, performance_report, backing_up_report;
 extern int reentrant, bison_bridge_lval, bison_bridge_lloc;
 extern bool ansi_func_defs, ansi_func_protos;
 extern int C_plus_plus, long_align, use_read, yytext_is_array, do_yywrap;
-extern int csize;
+extern int zero_copy, read_ahead, token_batch, push_scanner, parallel_scan;
+extern int skip_loops, lazy_dfa, utf8, profile_counters;
+extern int csize, dfa_threads, hybrid_size, minimize;
 extern int yymore_used, reject, real_reject, continued_action, in_rule;
 
 extern int yymore_really_used, reject_really_used;
@@ -424,6 +478,11 @@ extern int yymore_really_used, reject_really_used;
  * infilename - name of input file
  * outfilename - name of output file
  * headerfilename - name of the .h file to generate
+ * profile_gen_file - with --profile-gen, where the scanner writes its
+ *	DFA state visit counts
+ * profile_use_file - with --profile-use, the counts to order the states by
+ * tables_source_name - with --tables-source, the file the tables go to
+ * tables_source_out - that file, once open
  * did_outfilename - whether outfilename was explicitly set
  * prefix - the prefix used for externally visible names ("yy" by default)
  * yyclass - yyFlexLexer subclass to use for YY_DECL
@@ -448,6 +507,9 @@ extern FILE *skelfile, *yyin, *backing_up_file;
 extern const char *skel[];
 extern int skel_ind;
 extern char *infilename, *outfilename, *headerfilename;
+extern char *profile_gen_file, *profile_use_file;
+extern char *tables_source_name;
+extern FILE *tables_source_out;
 extern int did_outfilename;
 extern char *prefix, *yyclass, *extra_type;
 extern int do_stdinit, use_stdout;
@@ -617,6 +679,12 @@ extern char **scname;
  * jambase - position in base/def where the default jam table starts
  * jamstate - state number corresponding to "jam" state
  * end_of_buffer_state - end-of-buffer dfa state number
+ * skipmode - kind of skip loop (SKIP_UNTIL or SKIP_WHILE) for each dfa
+ *	state, or 0 if it has none
+ * skipset - the SKIP_SET_SIZE characters each skip loop watches for
+ * lazystart - NFA state each start state begins from with --lazy-dfa
+ * num_full_rows - with --hybrid, states 1 through num_full_rows also have
+ *	a full row of transitions
  */
 
 extern int current_max_dfa_size, current_max_xpairs;
@@ -631,6 +699,7 @@ extern union dfaacc_union {
 extern int *accsiz, *dhash, numas;
 extern int numsnpairs, jambase, jamstate;
 extern int end_of_buffer_state;
+extern int *skipmode, *skipset, *lazystart, num_full_rows;
 
 /* Variables for ccl information:
  * lastccl - ccl index of the last created ccl
@@ -642,11 +711,18 @@ extern int end_of_buffer_state;
  * current_max_ccl_tbl_size - current limit on number of characters needed
  *	to represent the unique ccl's
  * ccltbl - holds the characters in each ccl - indexed by cclmap
+ * cclrng - with --utf8, the first of a ccl's ranges of non-ASCII code
+ *	points, or 0 if it has none
+ * rngfirst, rnglast, rngnext - the code points in each range, and the next
+ *	range in the same ccl
+ * lastrng - index of the last range created
+ * current_max_rngs - current limit on the number of ranges
  */
 
 extern int lastccl, *cclmap, *ccllen, *cclng, cclreuse;
 extern int current_maxccls, current_max_ccl_tbl_size;
 extern Char *ccltbl;
+extern int *cclrng, *rngfirst, *rnglast, *rngnext, lastrng, current_max_rngs;
 
 
 /* Variables for miscellaneous information:
@@ -655,6 +731,7 @@ extern Char *ccltbl;
  * nummt - number of empty nxt/chk table entries
  * hshcol - number of hash collisions detected by snstods
  * dfaeql - number of times a newly created dfa was equal to an old one
+ * nummerged - number of DFA states merged away by minimization
  * numeps - number of epsilon NFA states created
  * eps2 - number of epsilon states which have 2 out-transitions
  * num_reallocs - number of times it was necessary to realloc() a group
@@ -671,7 +748,7 @@ extern Char *ccltbl;
 
 extern char nmstr[MAXLINE];
 extern int sectnum, nummt, hshcol, dfaeql, numeps, eps2, num_reallocs;
-extern int tmpuses, totnst, peakpairs, numuniq, numdup, hshsave;
+extern int tmpuses, totnst, peakpairs, numuniq, numdup, hshsave, nummerged;
 extern int num_backing_up, bol_needed;
 
 void   *allocate_array PROTO ((int, size_t));
@@ -743,6 +820,12 @@ extern void cclnegate PROTO ((int));	/* negate a ccl */
 extern int ccl_set_diff (int a, int b); /* set difference of two ccls. */
 extern int ccl_set_union (int a, int b); /* set union of two ccls. */
 
+/* Add a range of characters, or with --utf8 code points, to a ccl. */
+extern void ccladd_range PROTO ((int, int, int));
+
+/* Get the sorted code point ranges a ccl matches, with --utf8. */
+extern int ccl_ranges PROTO ((int, int **));
+
 /* List the members of a set of characters in CCL form. */
 extern void list_character_set PROTO ((FILE *, int[]));
 
@@ -755,6 +838,9 @@ extern void check_for_backing_up PROTO ((int, int[]));
 /* Check to see if NFA state set constitutes "dangerous" trailing context. */
 extern void check_trailing_context PROTO ((int *, int, int *, int));
 
+/* Check a DFA state for a self-loop worth a skip loop. */
+extern void check_for_skip_loop PROTO ((int, int[]));
+
 /* Construct the epsilon closure of a set of ndfa states. */
 extern int *epsclosure PROTO ((int *, int *, int[], int *, int *));
 
@@ -763,6 +849,9 @@ extern void increase_max_dfas PROTO ((void));
 
 extern void ntod PROTO ((void));	/* convert a ndfa to a dfa */
 
+/* Set up the start states for a scanner that builds its own DFA. */
+extern void mklazy PROTO ((void));
+
 /* Converts a set of ndfa states into a dfa state. */
 extern int snstods PROTO ((int[], int, int[], int, int, int *));
 
@@ -803,12 +892,33 @@ extern void genftbl PROTO ((void));	/* generate full transition table */
 /* Generate the code to find the next compressed-table state. */
 extern void gen_next_compressed_state PROTO ((char *));
 
+/* Generate the direct-coded (-Cg) code to find the next match. */
+extern void gen_direct_match PROTO ((char *));
+
 /* Generate the code to find the next match. */
 extern void gen_next_match PROTO ((void));
 
 /* Generate the code to find the next state. */
 extern void gen_next_state PROTO ((int));
 
+/* Generate the code to run through a skip loop. */
+extern void gen_skip_loop PROTO ((int));
+
+/* Generate the skip loop tables. */
+extern void genskip PROTO ((void));
+
+/* Generate the NFA tables for a scanner that builds its own DFA. */
+extern void genlazy PROTO ((void));
+
+/* Generate the code to count a visit to a state, for --profile-gen. */
+extern void gen_profile_visit PROTO ((void));
+
+/* Generate the state visit counters for --profile-gen. */
+extern void genprofile PROTO ((void));
+
+/* Generate the full rows of the busiest states, for --hybrid. */
+extern void genhybrid PROTO ((void));
+
 /* Generate the code to make a NUL transition. */
 extern void gen_NUL_trans PROTO ((void));
 
@@ -831,6 +941,20 @@ extern void make_tables PROTO ((void));	/* generate transition tables */
 
 extern void check_options PROTO ((void));
 extern void flexend PROTO ((int));
+
+/* The phases of a flex run, as timed for --stats=json. */
+#define PHASE_SETUP 0		/* options, output files, filter chain */
+#define PHASE_PARSE 1		/* scan.l and parse.y, building the NFA */
+#define PHASE_ECS 2		/* equivalence classes, definitions output */
+#define PHASE_DFA 3		/* ntod()'s subset construction */
+#define PHASE_MINIMIZE 4	/* minimize_dfa() and state ordering */
+#define PHASE_COMPRESS 5	/* tblcmp.c table compression */
+#define PHASE_TABLES 6		/* make_tables() */
+#define PHASE_M4 7		/* expanding m4, or draining the filter chain */
+#define NUM_PHASES 8
+
+/* End the current phase and start the given one; NUM_PHASES just ends it. */
+extern void phase_mark PROTO ((int));
 extern void usage PROTO ((void));
 
 
@@ -957,6 +1081,14 @@ extern char *readable_form PROTO ((int));
 /* Write out one section of the skeleton file. */
 extern void skelout PROTO ((void));
 
+/* Begin the definition of a table, in the scanner or the --tables-source
+ * file.
+ */
+extern void table_begin PROTO ((const char *, const char *, int, int));
+
+/* Finish a table begun by table_begin(). */
+extern void table_end PROTO ((void));
+
 /* Output a yy_trans_info structure. */
 extern void transition_struct_out PROTO ((int, int));
 
@@ -1006,6 +1138,12 @@ extern int mkrep PROTO ((int, int, int));	/* make a replicated machine */
 /* Create a state with a transition on a given symbol. */
 extern int mkstate PROTO ((int));
 
+/* Make a machine matching the UTF-8 bytes of a code point. */
+extern int mkutf8char PROTO ((int));
+
+/* Make a machine matching the UTF-8 bytes of any code point in a ccl. */
+extern int mkutf8ccl PROTO ((int, int *));
+
 extern void new_rule PROTO ((void));	/* initialize for a new rule */
 
 
@@ -1014,6 +1152,9 @@ extern void new_rule PROTO ((void));	/* initialize for a new rule */
 /* Build the "<<EOF>>" action for the active start conditions. */
 extern void build_eof_action PROTO ((void));
 
+/* Make a machine for a ccl of code points, with --utf8. */
+extern int mkutf8singl PROTO ((int));
+
 /* Write out a message formatted with one string, pinpointing its location. */
 extern void format_pinpoint_message PROTO ((const char *, const char *));
 
@@ -1066,6 +1207,15 @@ extern void scinstal PROTO ((const char *, int));	/* make a start condition */
 extern int sclookup PROTO ((const char *));
 
 
+/* from file unicode.c */
+
+/* Find the mask for a Unicode property name, or 0. */
+extern int uniprop_lookup PROTO ((const char *));
+
+/* Add the code points with (or without) a Unicode property to a ccl. */
+extern void ccl_add_uniprop PROTO ((int, int));
+
+
 /* from file tblcmp.c */
 
 /* Build table entries for dfa state. */
@@ -1081,6 +1231,9 @@ extern void inittbl PROTO ((void));	/* initialize transition tables */
 /* Make the default, "jam" table entries. */
 extern void mkdeftbl PROTO ((void));
 
+/* Place the entries mkentry() put off with -Cx. */
+extern void pack_entries PROTO ((void));
+
 /* Create table entries for a state (or state fragment) which has
  * only one out-transition.
  */
@@ -1189,6 +1342,24 @@ extern bool filter_apply_chain PROTO((struct filter * chain));
 extern int filter_truncate (struct filter * chain, int max_len);
 extern int filter_tee_header PROTO((struct filter *chain));
 extern int filter_fix_linedirs PROTO((struct filter *chain));
+extern void filter_capture PROTO((void));
+extern void filter_expand PROTO((int));
+
+
+/*
+ *  From "m4.c"
+ */
+
+/* An in-process m4 expander. */
+struct m4;
+extern struct m4 *m4_create PROTO((void (*emit) (void *, const char *, int),
+				   void *emit_arg));
+extern void m4_destroy PROTO((struct m4 *m));
+extern void m4_define PROTO((struct m4 *m, const char *name, const char *value));
+extern void m4_set_quotes PROTO((struct m4 *m, const char *lq, const char *rq));
+extern void m4_set_comments PROTO((struct m4 *m, const char *bc, const char *ec));
+extern void m4_push PROTO((struct m4 *m, const char *text, int len));
+extern void m4_run PROTO((struct m4 *m));
 
 
 /*
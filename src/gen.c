@@ -55,19 +55,20 @@ static int indent_level = 0;	/* each level is 8 spaces */
  * 0 elements of its arrays, too.)
  */
 
-static const char *get_int16_decl (void)
-{
-	return (gentables)
-		? "static yyconst flex_int16_t %s[%d] =\n    {   0,\n"
-		: "static yyconst flex_int16_t * %s = 0;\n";
-}
-
-
-static const char *get_int32_decl (void)
+/* out_table - begin the definition of table "name", n elements of "type"
+ * starting with that null entry, or with --tables-file, the pointer that
+ * loading the tables will set
+ */
+static void out_table (const char *type, const char *name, int n)
 {
-	return (gentables)
-		? "static yyconst flex_int32_t %s[%d] =\n    {   0,\n"
-		: "static yyconst flex_int32_t * %s = 0;\n";
+	if (gentables) {
+		table_begin (type, name, n, 0);
+		outn ("    {   0,");
+	}
+	else {
+		out_str ("static yyconst %s * ", type);
+		out_str ("%s = 0;\n", name);
+	}
 }
 
 static const char *get_state_decl (void)
@@ -114,9 +115,8 @@ static struct yytbl_data *mkeoltbl (void)
 	for (i = 1; i <= num_rules; i++)
 		tdata[i] = rule_has_nl[i] ? 1 : 0;
 
-	buf_prints (&yydmap_buf,
-		    "\t{YYTD_ID_RULE_CAN_MATCH_EOL, (void**)&yy_rule_can_match_eol, sizeof(%s)},\n",
-		    "flex_int32_t");
+	yytbl_dmap_add (YYTD_ID_RULE_CAN_MATCH_EOL, "yy_rule_can_match_eol",
+			"flex_int32_t");
 	return tbl;
 }
 
@@ -127,8 +127,8 @@ static void geneoltbl ()
 
 	outn ("m4_ifdef( [[M4_YY_USE_LINENO]],[[");
 	outn ("/* Table of booleans, true if rule could match eol. */");
-	out_str_dec (get_int32_decl (), "yy_rule_can_match_eol",
-		     num_rules + 1);
+	out_table ("flex_int32_t", "yy_rule_can_match_eol",
+		   num_rules + 1);
 
 	if (gentables) {
 		for (i = 1; i <= num_rules; i++) {
@@ -138,6 +138,7 @@ static void geneoltbl ()
 				out ("\n    ");
 		}
 		out ("    };\n");
+		table_end ();
 	}
 	outn ("]])");
 }
@@ -152,6 +153,9 @@ void gen_backing_up ()
 
 	if (fullspd)
 		indent_puts ("if ( yy_current_state[-1].yy_nxt )");
+	else if (lazy_dfa)
+		indent_puts
+			("if ( YY_G(yy_lazy)->yy_accept[yy_current_state] )");
 	else
 		indent_puts ("if ( yy_accept[yy_current_state] )");
 
@@ -164,6 +168,28 @@ void gen_backing_up ()
 }
 
 
+/* Generate the code to count backing up, for %option profile.  A
+ * compressed scanner always "backs up" over the character it jammed on,
+ * so "cond" picks out the times it really had to go further back.
+ */
+
+void gen_profile_backup (cond)
+     const char *cond;
+{
+	if (!profile_counters)
+		return;
+
+	if (cond) {
+		indent_put2s ("if ( %s )", cond);
+		indent_up ();
+		indent_puts ("++YY_G(yy_prof).yy_backups;");
+		indent_down ();
+	}
+	else
+		indent_puts ("++YY_G(yy_prof).yy_backups;");
+}
+
+
 /* Generate the code to perform the backing up. */
 
 void gen_bu_action ()
@@ -175,7 +201,8 @@ void gen_bu_action ()
 
 	indent_puts ("case 0: /* must back up */");
 	indent_puts ("/* undo the effects of YY_DO_BEFORE_ACTION */");
-	indent_puts ("*yy_cp = YY_G(yy_hold_char);");
+	indent_puts ("YY_RESTORE_HOLD_CHAR");
+	gen_profile_backup (NULL);
 
 	if (fullspd || fulltbl)
 		indent_puts ("yy_cp = YY_G(yy_last_accepting_cpos) + 1;");
@@ -206,10 +233,9 @@ static struct yytbl_data *mkctbl (void)
 	flex_int32_t *tdata = 0, curr = 0;
 	int     end_of_buffer_action = num_rules + 1;
 
-	buf_prints (&yydmap_buf,
-		    "\t{YYTD_ID_TRANSITION, (void**)&yy_transition, sizeof(%s)},\n",
-		    ((tblend + numecs + 1) >= INT16_MAX
-		     || long_align) ? "flex_int32_t" : "flex_int16_t");
+	yytbl_dmap_add (YYTD_ID_TRANSITION, "yy_transition",
+			((tblend + numecs + 1) >= INT16_MAX || long_align) ?
+			"flex_int32_t" : "flex_int16_t");
 
 	tbl = (struct yytbl_data *) calloc (1, sizeof (struct yytbl_data));
 	yytbl_data_init (tbl, YYTD_ID_TRANSITION);
@@ -319,9 +345,8 @@ static struct yytbl_data *mkssltbl (void)
 	for (i = 0; i <= lastsc * 2; ++i)
 		tdata[i] = base[i];
 
-	buf_prints (&yydmap_buf,
-		    "\t{YYTD_ID_START_STATE_LIST, (void**)&yy_start_state_list, sizeof(%s)},\n",
-		    "struct yy_trans_info*");
+	yytbl_dmap_add (YYTD_ID_START_STATE_LIST, "yy_start_state_list",
+			"struct yy_trans_info*");
 
 	return tbl;
 }
@@ -336,8 +361,11 @@ void genctbl ()
 	int     end_of_buffer_action = num_rules + 1;
 
 	/* Table of verify for transition and offset to next state. */
-	if (gentables)
-		out_dec ("static yyconst struct yy_trans_info yy_transition[%d] =\n    {\n", tblend + numecs + 1);
+	if (gentables) {
+		table_begin ("struct yy_trans_info", "yy_transition",
+			     tblend + numecs + 1, 0);
+		outn ("    {");
+	}
 	else
 		outn ("static yyconst struct yy_trans_info *yy_transition = 0;");
 
@@ -406,12 +434,15 @@ void genctbl ()
 	transition_struct_out (chk[tblend + 1], nxt[tblend + 1]);
 	transition_struct_out (chk[tblend + 2], nxt[tblend + 2]);
 
-	if (gentables)
+	if (gentables) {
 		outn ("    };\n");
+		table_end ();
+	}
 
 	/* Table of pointers to start states. */
 	if (gentables)
-		out_dec ("static yyconst struct yy_trans_info *yy_start_state_list[%d] =\n", lastsc * 2 + 1);
+		table_begin ("struct yy_trans_info *", "yy_start_state_list",
+			     lastsc * 2 + 1, 0);
 	else
 		outn ("static yyconst struct yy_trans_info **yy_start_state_list =0;");
 
@@ -451,9 +482,7 @@ struct yytbl_data *mkecstbl (void)
 		tdata[i] = ecgroup[i];
 	}
 
-	buf_prints (&yydmap_buf,
-		    "\t{YYTD_ID_EC, (void**)&yy_ec, sizeof(%s)},\n",
-		    "flex_int32_t");
+	yytbl_dmap_add (YYTD_ID_EC, "yy_ec", "flex_int32_t");
 
 	return tbl;
 }
@@ -465,7 +494,7 @@ void genecs ()
 	register int i, j;
 	int     numrows;
 
-	out_str_dec (get_int32_decl (), "yy_ec", csize);
+	out_table ("flex_int32_t", "yy_ec", csize);
 
 	for (i = 1; i < csize; ++i) {
 		ecgroup[i] = ABS (ecgroup[i]);
@@ -610,7 +639,11 @@ void gen_find_action ()
 	}
 
 	else {			/* compressed */
-		indent_puts ("yy_act = yy_accept[yy_current_state];");
+		const char *find_act = lazy_dfa ?
+			"yy_act = YY_G(yy_lazy)->yy_accept[yy_current_state];" :
+			"yy_act = yy_accept[yy_current_state];";
+
+		indent_puts (find_act);
 
 		if (interactive && !reject) {
 			/* Do the guaranteed-needed backing up to figure out
@@ -619,12 +652,13 @@ void gen_find_action ()
 			indent_puts ("if ( yy_act == 0 )");
 			indent_up ();
 			indent_puts ("{ /* have to back up */");
+			gen_profile_backup
+				("yy_cp != YY_G(yy_last_accepting_cpos) + 1");
 			indent_puts
 				("yy_cp = YY_G(yy_last_accepting_cpos);");
 			indent_puts
 				("yy_current_state = YY_G(yy_last_accepting_state);");
-			indent_puts
-				("yy_act = yy_accept[yy_current_state];");
+			indent_puts (find_act);
 			indent_puts ("}");
 			indent_down ();
 		}
@@ -663,9 +697,8 @@ struct yytbl_data *mkftbl (void)
 				 i, anum);
 	}
 
-	buf_prints (&yydmap_buf,
-		    "\t{YYTD_ID_ACCEPT, (void**)&yy_accept, sizeof(%s)},\n",
-		    long_align ? "flex_int32_t" : "flex_int16_t");
+	yytbl_dmap_add (YYTD_ID_ACCEPT, "yy_accept",
+			long_align ? "flex_int32_t" : "flex_int16_t");
 	return tbl;
 }
 
@@ -677,8 +710,8 @@ void genftbl ()
 	register int i;
 	int     end_of_buffer_action = num_rules + 1;
 
-	out_str_dec (long_align ? get_int32_decl () : get_int16_decl (),
-		     "yy_accept", lastdfa + 1);
+	out_table (long_align ? "flex_int32_t" : "flex_int16_t",
+		   "yy_accept", lastdfa + 1);
 
 	dfaacc[end_of_buffer_state].dfaacc_state = end_of_buffer_action;
 
@@ -708,7 +741,14 @@ void genftbl ()
 void gen_next_compressed_state (char_map)
      char   *char_map;
 {
-	indent_put2s ("register YY_CHAR yy_c = %s;", char_map);
+	/* Without equivalence classes NUL's class is csize, which doesn't
+	 * fit in a YY_CHAR; the lazy rows have a column for it, apart from
+	 * the end-of-buffer one.
+	 */
+	if (lazy_dfa)
+		indent_put2s ("register int yy_c = %s;", char_map);
+	else
+		indent_put2s ("register YY_CHAR yy_c = %s;", char_map);
 
 	/* Save the backing-up info \before/ computing the next state
 	 * because we always compute one more state than needed - we
@@ -716,6 +756,33 @@ void gen_next_compressed_state (char_map)
 	 */
 	gen_backing_up ();
 
+	if (lazy_dfa) {
+		/* Transitions the scanner hasn't needed yet are -1. */
+		indent_puts ("{");
+		indent_puts
+			("register yy_state_type yy_next = YY_G(yy_lazy)->yy_trans[yy_current_state * YY_LAZY_ROW + (unsigned int) yy_c];");
+		indent_puts ("if ( yy_next < 0 )");
+		indent_up ();
+		indent_puts
+			("yy_next = yy_lazy_build( yy_current_state, yy_c M4_YY_CALL_LAST_ARG );");
+		indent_down ();
+		indent_puts ("yy_current_state = yy_next;");
+		indent_puts ("}");
+		return;
+	}
+
+	if (num_full_rows > 0) {
+		/* The busiest states go straight to their full row. */
+		indent_puts ("if ( yy_current_state <= YY_FULL_ROWS )");
+		indent_up ();
+		indent_puts
+			("yy_current_state = yy_full_nxt[yy_current_state * YY_FULL_ROW_LEN + (unsigned int) yy_c];");
+		indent_down ();
+		indent_puts ("else");
+		indent_up ();
+		indent_puts ("{");
+	}
+
 	indent_puts
 		("while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )");
 	indent_up ();
@@ -745,6 +812,234 @@ void gen_next_compressed_state (char_map)
 
 	indent_puts
 		("yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];");
+
+	if (num_full_rows > 0) {
+		indent_puts ("}");
+		indent_down ();
+	}
+}
+
+
+/* Find the transition out of state "s" on equivalence class "c" in the
+ * compressed tables, just as the code from gen_next_compressed_state()
+ * does at run time.  The tables must already have been written out.
+ */
+
+static int compressed_next (s, c)
+     int s, c;
+{
+	while (chk[base[s] + c] != s) {
+		s = def[s];
+
+		if (usemecs && s >= lastdfa + 2 && c > 0)
+			c = ABS (tecbck[c]);
+	}
+
+	return nxt[base[s] + c];
+}
+
+
+/* Generate the direct-coded (-Cg) code to find the next match.  Each DFA
+ * state becomes a labeled block which switches on the next character's
+ * equivalence class and goes straight to the block for the state that
+ * follows, so the compressed tables are only needed for the rare cases
+ * (backing up across a buffer refill, NUL transitions) handled elsewhere.
+ * The code does exactly what the "do ... while" loop built from
+ * gen_next_state() would, including the backing-up information and, for
+ * REJECT, the state stack.
+ */
+
+void gen_direct_match (char_map)
+     char   *char_map;
+{
+	int    *targets, *is_target;
+	int     s, c, t, i, num_chars, common, freq, best_freq, first_char;
+	int     jam_used = false, done_used = false;
+	int    *chars, *counts;
+
+	/* The classes a character can map to at run time. */
+	chars = allocate_integer_array (CSIZE + 1);
+	num_chars = 0;
+
+	chars[num_chars++] = 0;
+
+	if (useecs) {
+		int    *seen = allocate_integer_array (numecs + 1);
+
+		for (i = 0; i <= numecs; ++i)
+			seen[i] = false;
+
+		for (i = 1; i < csize; ++i)
+			if (!seen[ABS (ecgroup[i])]) {
+				seen[ABS (ecgroup[i])] = true;
+				chars[num_chars++] = ABS (ecgroup[i]);
+			}
+
+		flex_free ((void *) seen);
+	}
+
+	else
+		for (i = 1; i < csize; ++i)
+			chars[num_chars++] = i;
+
+	targets = allocate_integer_array (num_chars);
+	counts = allocate_integer_array (lastdfa + 2);
+	is_target = allocate_integer_array (lastdfa + 2);
+
+	for (s = 1; s <= lastdfa + 1; ++s)
+		is_target[s] = counts[s] = 0;
+
+	for (s = 1; s <= lastdfa; ++s)
+		for (i = 0; i < num_chars; ++i)
+			is_target[compressed_next (s, chars[i])] = true;
+
+	indent_puts ("{");
+	indent_puts ("register YY_CHAR yy_c;");
+	outc ('\n');
+
+	indent_puts ("switch ( yy_current_state )");
+	indent_up ();
+	indent_puts ("{");
+
+	for (s = 1; s <= lastdfa; ++s) {
+		do_indent ();
+		out_dec2 ("case %d: goto yy_state_%d;\n", s, s);
+	}
+
+	indent_puts ("}");
+	indent_down ();
+
+	for (s = 1; s <= lastdfa; ++s) {
+		outc ('\n');
+
+		if (is_target[s]) {
+			out_dec ("yy_to_%d:\n", s);
+
+			if (reject) {
+				do_indent ();
+				out_dec ("*YY_G(yy_state_ptr)++ = %d;\n", s);
+			}
+
+			if (skip_loops && skipmode[s]) {
+				char    line[256];
+
+				snprintf (line, sizeof (line),
+					  "yy_cp = yy_skip_run( yy_cp, %d, &yy_skip_set[%d]%s );",
+					  skipmode[s], s * SKIP_SET_SIZE,
+					  zero_copy ? ", yy_ep" : "");
+				indent_puts (line);
+			}
+
+			if (interactive && base[s] == jambase) {
+				/* Nothing leads out of this state, so don't
+				 * look at another character.
+				 */
+				do_indent ();
+				out_dec ("yy_current_state = %d;\n", s);
+				indent_puts ("goto yy_direct_done;");
+				done_used = true;
+			}
+		}
+
+		out_dec ("yy_state_%d:\n", s);
+
+		if (!reject && num_backing_up > 0 &&
+		    dfaacc[s].dfaacc_state) {
+			do_indent ();
+			out_dec ("YY_G(yy_last_accepting_state) = %d;\n", s);
+			indent_puts ("YY_G(yy_last_accepting_cpos) = yy_cp;");
+		}
+
+		indent_put2s ("yy_c = %s;", char_map);
+		indent_puts ("++yy_cp;");
+
+		/* The most common destination becomes the default. */
+		for (i = 0; i < num_chars; ++i) {
+			targets[i] = compressed_next (s, chars[i]);
+			++counts[targets[i]];
+		}
+
+		common = targets[0];
+		best_freq = 0;
+
+		for (i = 0; i < num_chars; ++i) {
+			freq = counts[targets[i]];
+
+			if (freq > best_freq) {
+				best_freq = freq;
+				common = targets[i];
+			}
+		}
+
+		indent_puts ("switch ( yy_c )");
+		indent_up ();
+		indent_puts ("{");
+
+		for (i = 0; i < num_chars; ++i) {
+			t = targets[i];
+
+			if (t == common || counts[t] == 0)
+				continue;
+
+			/* Gather all the classes leading to t. */
+			do_indent ();
+			first_char = true;
+
+			for (c = i; c < num_chars; ++c)
+				if (targets[c] == t) {
+					out_dec (first_char ? "case %d:" : " case %d:",
+						 chars[c]);
+					first_char = false;
+				}
+
+			counts[t] = 0;
+
+			if (t == jamstate) {
+				outn (" goto yy_jam;");
+				jam_used = true;
+			}
+			else
+				out_dec (" goto yy_to_%d;\n", t);
+		}
+
+		if (common == jamstate) {
+			indent_puts ("default: goto yy_jam;");
+			jam_used = true;
+		}
+		else {
+			do_indent ();
+			out_dec ("default: goto yy_to_%d;\n", common);
+		}
+
+		indent_puts ("}");
+		indent_down ();
+
+		for (i = 0; i < num_chars; ++i)
+			counts[targets[i]] = 0;
+	}
+
+	if (jam_used) {
+		outc ('\n');
+		outn ("yy_jam:");
+
+		if (reject) {
+			do_indent ();
+			out_dec ("*YY_G(yy_state_ptr)++ = %d;\n", jamstate);
+		}
+
+		do_indent ();
+		out_dec ("yy_current_state = %d;\n", jamstate);
+	}
+
+	if (done_used)
+		outn ("yy_direct_done: ;");
+
+	indent_puts ("}");
+
+	flex_free ((void *) chars);
+	flex_free ((void *) targets);
+	flex_free ((void *) counts);
+	flex_free ((void *) is_target);
 }
 
 
@@ -761,6 +1056,19 @@ void gen_next_match ()
 	char   *char_map_2 = useecs ?
 		"yy_ec[YY_SC_TO_UI(*++yy_cp)] " : "YY_SC_TO_UI(*++yy_cp)";
 
+	if (zero_copy) {
+		/* There's no EOB character after the input, so read the
+		 * end of the buffer as one.
+		 */
+		char_map = useecs ?
+			"yy_ec[YY_SC_TO_UI(YY_CP_CHAR)] " :
+			"YY_SC_TO_UI(YY_CP_CHAR)";
+
+		char_map_2 = useecs ?
+			"yy_ec[YY_SC_TO_UI((++yy_cp, YY_CP_CHAR))] " :
+			"YY_SC_TO_UI((++yy_cp, YY_CP_CHAR))";
+	}
+
 	if (fulltbl) {
 		if (gentables)
 			indent_put2s
@@ -773,15 +1081,25 @@ void gen_next_match ()
 
 		indent_up ();
 
-		if (num_backing_up > 0) {
+		if (num_backing_up > 0 || skip_loops || profile_gen_file)
 			indent_puts ("{");
+
+		gen_profile_visit ();
+
+		if (skip_loops)
+			/* yy_cp is still on the character which took us
+			 * into this state.
+			 */
+			gen_skip_loop (1);
+
+		if (num_backing_up > 0) {
 			gen_backing_up ();
 			outc ('\n');
 		}
 
 		indent_puts ("++yy_cp;");
 
-		if (num_backing_up > 0)
+		if (num_backing_up > 0 || skip_loops || profile_gen_file)
 
 			indent_puts ("}");
 
@@ -804,47 +1122,61 @@ void gen_next_match ()
 
 		indent_up ();
 
-		if (num_backing_up > 0)
+		if (num_backing_up > 0 || profile_gen_file)
 			indent_puts ("{");
 
 		indent_puts ("yy_current_state += yy_trans_info->yy_nxt;");
+		gen_profile_visit ();
 
 		if (num_backing_up > 0) {
 			outc ('\n');
 			gen_backing_up ();
-			indent_puts ("}");
 		}
 
+		if (num_backing_up > 0 || profile_gen_file)
+			indent_puts ("}");
+
 		indent_down ();
 		indent_puts ("}");
 	}
 
 	else {			/* compressed */
-		indent_puts ("do");
+		if (directcode)
+			gen_direct_match (char_map);
 
-		indent_up ();
-		indent_puts ("{");
+		else {
+			indent_puts ("do");
 
-		gen_next_state (false);
+			indent_up ();
+			indent_puts ("{");
 
-		indent_puts ("++yy_cp;");
+			gen_next_state (false);
 
+			indent_puts ("++yy_cp;");
 
-		indent_puts ("}");
-		indent_down ();
+			if (skip_loops)
+				gen_skip_loop (0);
 
-		do_indent ();
+			indent_puts ("}");
+			indent_down ();
 
-		if (interactive)
-			out_dec ("while ( yy_base[yy_current_state] != %d );\n", jambase);
-		else
-			out_dec ("while ( yy_current_state != %d );\n",
-				 jamstate);
+			do_indent ();
+
+			if (interactive && lazy_dfa)
+				outn ("while ( YY_G(yy_lazy)->yy_out[yy_current_state] );");
+			else if (interactive)
+				out_dec ("while ( yy_base[yy_current_state] != %d );\n", jambase);
+			else
+				out_dec ("while ( yy_current_state != %d );\n",
+					 jamstate);
+		}
 
 		if (!reject && !interactive) {
 			/* Do the guaranteed-needed backing up to figure out
 			 * the match.
 			 */
+			gen_profile_backup
+				("yy_cp != YY_G(yy_last_accepting_cpos) + 1");
 			indent_puts
 				("yy_cp = YY_G(yy_last_accepting_cpos);");
 			indent_puts
@@ -872,6 +1204,11 @@ void gen_next_state (worry_about_NULs)
 					NUL_ec);
 	}
 
+	else if (zero_copy && !worry_about_NULs)
+		strcpy (char_map, useecs ?
+			"yy_ec[YY_SC_TO_UI(YY_CP_CHAR)] " :
+			"YY_SC_TO_UI(YY_CP_CHAR)");
+
 	else
 		strcpy (char_map, useecs ?
 			"yy_ec[YY_SC_TO_UI(*yy_cp)] " :
@@ -917,6 +1254,8 @@ void gen_next_state (worry_about_NULs)
 		indent_down ();
 	}
 
+	gen_profile_visit ();
+
 	if (fullspd || fulltbl)
 		gen_backing_up ();
 
@@ -925,6 +1264,170 @@ void gen_next_state (worry_about_NULs)
 }
 
 
+/* Generate the code to count a visit to the state just entered, for
+ * --profile-gen.  -Cf jams come out as negative state numbers.
+ */
+
+void gen_profile_visit ()
+{
+	if (!profile_gen_file)
+		return;
+
+	if (fullspd)
+		indent_puts
+			("++yy_state_visits[yy_current_state - yy_transition];");
+	else if (fulltbl)
+		indent_puts
+			("++yy_state_visits[yy_current_state > 0 ? yy_current_state : -yy_current_state];");
+	else
+		indent_puts ("++yy_state_visits[yy_current_state];");
+}
+
+
+/* Generate the counters for --profile-gen.  A -CF scanner's states are
+ * pointers into yy_transition, so it counts by offset, and looks up each
+ * state's count at its base when it writes them out.
+ */
+
+void genprofile ()
+{
+	register int i;
+
+	out_dec ("#define YY_PROFILE_NUM_STATES %d\n", lastdfa);
+	out_dec ("#define YY_PROFILE_NUM_ECS %d\n", numecs);
+	out_str ("#define YY_PROFILE_FILE \"%s\"\n", profile_gen_file);
+
+	if (fullspd) {
+		out_dec ("static unsigned long yy_state_visits[%d];\n",
+			 tblend + numecs + 2);
+
+		table_begin ("flex_int32_t", "yy_profile_base", lastdfa + 1, 0);
+		outn ("    {   0,");
+
+		for (i = 1; i <= lastdfa; ++i)
+			mkdata (base[i]);
+
+		dataend ();
+
+		outn ("#define YY_PROFILE_COUNT(s) (*(yy_state_visits + yy_profile_base[s]))");
+	}
+
+	else {
+		out_dec ("static unsigned long yy_state_visits[%d];\n",
+			 lastdfa + 2);
+		outn ("#define YY_PROFILE_COUNT(s) (yy_state_visits[s])");
+	}
+}
+
+
+/* Generate the full rows for --hybrid.  With a profile the states are
+ * numbered busiest first, and otherwise densest first (but left in
+ * minimized order under --profile-gen), so the rows go to the states
+ * from 1 up to as many as fit in hybrid_size bytes.  Each row
+ * holds what the compressed tables give for every yy_c from 0 through
+ * numecs, jams included, so the scanner behaves the same whichever it
+ * uses.  Row 0 is never used but keeps the indexing simple.
+ */
+
+void genhybrid ()
+{
+	register int i, c, row_len, entry_size;
+
+	row_len = numecs + 1;
+	entry_size = (lastdfa + 1 >= INT16_MAX || long_align) ? 4 : 2;
+
+	num_full_rows = hybrid_size / (row_len * entry_size) - 1;
+
+	if (num_full_rows > lastdfa)
+		num_full_rows = lastdfa;
+
+	if (num_full_rows <= 0) {
+		num_full_rows = 0;
+		warn (_("--hybrid size is too small for even one full row"));
+		return;
+	}
+
+	out_dec ("#define YY_FULL_ROWS %d\n", num_full_rows);
+	out_dec ("#define YY_FULL_ROW_LEN %d\n", row_len);
+
+	out_table (entry_size == 4 ?
+		   "flex_int32_t" : "flex_int16_t", "yy_full_nxt",
+		   (num_full_rows + 1) * row_len);
+
+	for (c = 1; c < row_len; ++c)
+		mkdata (0);
+
+	for (i = 1; i <= num_full_rows; ++i)
+		for (c = 0; c < row_len; ++c)
+			mkdata (compressed_next (i, c));
+
+	dataend ();
+}
+
+
+/* Generate the code to run through a skip loop.  The run starts with the
+ * character after yy_cp if "after_cp" is true, and with yy_cp's otherwise;
+ * either way yy_cp is left the same distance before the character which
+ * ends it.
+ */
+
+void gen_skip_loop (after_cp)
+     int after_cp;
+{
+	char    line[256];
+
+	indent_puts ("if ( yy_skip[yy_current_state] )");
+	indent_up ();
+	indent_put2s ("yy_cp = yy_skip_run( yy_cp%s, yy_skip[yy_current_state],",
+		      after_cp ? " + 1" : "");
+	snprintf (line, sizeof (line),
+		  "\t&yy_skip_set[yy_current_state * YY_SKIP_SET_SIZE]%s )%s;",
+		  zero_copy ? ", yy_ep" : "", after_cp ? " - 1" : "");
+	indent_puts (line);
+	indent_down ();
+}
+
+
+/* Generate the skip loop tables.  The jam state gets an entry, too. */
+
+void genskip ()
+{
+	register int i, j;
+
+	out_dec ("#define YY_SKIP_UNTIL %d\n", SKIP_UNTIL);
+	out_dec ("#define YY_SKIP_WHILE %d\n", SKIP_WHILE);
+	out_dec ("#define YY_SKIP_SET_SIZE %d\n", SKIP_SET_SIZE);
+
+	/* Direct-coded scanners know which states have skip loops when
+	 * they're generated, so they only need the characters.
+	 */
+	if (!directcode) {
+		out_table ("flex_uint8_t", "yy_skip", lastdfa + 2);
+
+		for (i = 1; i <= lastdfa; ++i)
+			mkdata (skipmode[i]);
+
+		mkdata (0);
+		dataend ();
+	}
+
+	out_table ("flex_uint8_t", "yy_skip_set",
+		   (lastdfa + 2) * SKIP_SET_SIZE);
+
+	for (j = 1; j < SKIP_SET_SIZE; ++j)
+		mkdata (0);
+
+	for (i = 1; i <= lastdfa; ++i)
+		for (j = 0; j < SKIP_SET_SIZE; ++j)
+			mkdata (skipset[i * SKIP_SET_SIZE + j]);
+
+	for (j = 0; j < SKIP_SET_SIZE; ++j)
+		mkdata (0);
+
+	dataend ();
+}
+
+
 /* Generate the code to make a NUL transition. */
 
 void gen_NUL_trans ()
@@ -1043,6 +1546,149 @@ void gen_start_state ()
 }
 
 
+/* Set the bits for the equivalence classes character class "cclnum"
+ * matches in "bits", working them out the same way symfollowset() does.
+ */
+
+static void lazy_ccl_ecs (cclnum, bits)
+     int cclnum;
+     Char    bits[];
+{
+	int     ec, j, ch, in_ccl;
+	int     ccllist = cclmap[cclnum], lenccl = ccllen[cclnum];
+
+	for (ec = 1; ec <= numecs; ++ec) {
+		in_ccl = false;
+
+		for (j = 0; j < lenccl; ++j) {
+			ch = ccltbl[ccllist + j];
+
+			if (ch == 0)
+				ch = NUL_ec;
+
+			if (ch > ec)
+				break;
+
+			else if (ch == ec) {
+				in_ccl = true;
+				break;
+			}
+		}
+
+		if (cclng[cclnum])
+			in_ccl = !in_ccl;
+
+		if (in_ccl)
+			bits[ec / 8] |= 1 << (ec % 8);
+	}
+}
+
+
+/* genlazy - generate the NFA tables for a scanner that builds its own DFA
+ *
+ * Each NFA state gets its symbol (0 for epsilon, an equivalence class, or
+ * minus a character class), its out-transitions and the rule it accepts.
+ * The character classes are written out as bitmaps over the equivalence
+ * classes so the scanner can test membership directly.
+ */
+
+void genlazy ()
+{
+	register int i, j;
+	int     ccl_bytes = (numecs + 8) / 8;
+	Char   *bits;
+
+	/* The scanner backs up out of the jam state just as it does with
+	 * compressed tables.
+	 */
+	++num_backing_up;
+
+	out_dec ("#define YY_LAZY_ROW %d\n", numecs + 1);
+	out_dec ("#define YY_LAZY_EOB_STATE %d\n", end_of_buffer_state);
+	out_dec ("#define YY_LAZY_NFA_STATES %d\n", lastnfa);
+	out_dec ("#define YY_LAZY_CCL_BYTES %d\n", ccl_bytes);
+	outn ("#ifndef YY_LAZY_CACHE_SIZE");
+	outn ("#define YY_LAZY_CACHE_SIZE 2048");
+	outn ("#endif\n");
+
+	if (useecs)
+		genecs ();
+
+	out_table ((lastnfa >= INT16_MAX || long_align) ?
+		   "flex_int32_t" : "flex_int16_t",
+		   "yy_lazy_start", end_of_buffer_state);
+
+	for (i = 1; i < end_of_buffer_state; ++i)
+		mkdata (lazystart[i]);
+
+	dataend ();
+
+	out_table (long_align ? "flex_int32_t" : "flex_int16_t",
+		   "yy_nfa_sym", lastnfa + 1);
+
+	for (i = 1; i <= lastnfa; ++i) {
+		int     sym = transchar[i];
+
+		if (sym == SYM_EPSILON)
+			mkdata (0);
+		else if (sym < 0)
+			mkdata (sym);
+		else
+			mkdata (ABS (ecgroup[sym]));
+	}
+
+	dataend ();
+
+	out_table ((lastnfa >= INT16_MAX || long_align) ?
+		   "flex_int32_t" : "flex_int16_t",
+		   "yy_nfa_out1", lastnfa + 1);
+
+	for (i = 1; i <= lastnfa; ++i)
+		mkdata (trans1[i]);
+
+	dataend ();
+
+	out_table ((lastnfa >= INT16_MAX || long_align) ?
+		   "flex_int32_t" : "flex_int16_t",
+		   "yy_nfa_out2", lastnfa + 1);
+
+	for (i = 1; i <= lastnfa; ++i)
+		mkdata (trans2[i]);
+
+	dataend ();
+
+	out_table (long_align ? "flex_int32_t" : "flex_int16_t",
+		   "yy_nfa_accept", lastnfa + 1);
+
+	for (i = 1; i <= lastnfa; ++i)
+		mkdata (accptnum[i] == NIL ? 0 : accptnum[i]);
+
+	dataend ();
+
+	out_table ("flex_uint8_t", "yy_ccl_ecs",
+		   (lastccl + 1) * ccl_bytes);
+
+	for (j = 1; j < ccl_bytes; ++j)
+		mkdata (0);
+
+	bits = allocate_Character_array (ccl_bytes);
+
+	for (i = 1; i <= lastccl; ++i) {
+		for (j = 0; j < ccl_bytes; ++j)
+			bits[j] = 0;
+
+		lazy_ccl_ecs (i, bits);
+
+		for (j = 0; j < ccl_bytes; ++j)
+			mkdata (bits[j]);
+	}
+
+	dataend ();
+
+	flex_free ((void *) bits);
+}
+
+
 /* gentabs - generate data statements for the transition tables */
 
 void gentabs ()
@@ -1081,13 +1727,12 @@ void gentabs ()
 		dfaacc[end_of_buffer_state].dfaacc_set =
 			EOB_accepting_list;
 
-		out_str_dec (long_align ? get_int32_decl () :
-			     get_int16_decl (), "yy_acclist", MAX (numas,
-								   1) + 1);
+		out_table (long_align ? "flex_int32_t" :
+			   "flex_int16_t", "yy_acclist",
+			   MAX (numas, 1) + 1);
         
-        buf_prints (&yydmap_buf,
-                "\t{YYTD_ID_ACCLIST, (void**)&yy_acclist, sizeof(%s)},\n",
-                long_align ? "flex_int32_t" : "flex_int16_t");
+	yytbl_dmap_add (YYTD_ID_ACCLIST, "yy_acclist",
+			long_align ? "flex_int32_t" : "flex_int16_t");
 
         yyacclist_tbl = (struct yytbl_data*)calloc(1,sizeof(struct yytbl_data));
         yytbl_data_init (yyacclist_tbl, YYTD_ID_ACCLIST);
@@ -1191,12 +1836,11 @@ void gentabs ()
 		 */
 		++k;
 
-	out_str_dec (long_align ? get_int32_decl () : get_int16_decl (),
-		     "yy_accept", k);
+	out_table (long_align ? "flex_int32_t" : "flex_int16_t",
+		   "yy_accept", k);
 
-	buf_prints (&yydmap_buf,
-		    "\t{YYTD_ID_ACCEPT, (void**)&yy_accept, sizeof(%s)},\n",
-		    long_align ? "flex_int32_t" : "flex_int16_t");
+	yytbl_dmap_add (YYTD_ID_ACCEPT, "yy_accept",
+			long_align ? "flex_int32_t" : "flex_int16_t");
 
 	yyacc_tbl =
 		(struct yytbl_data *) calloc (1,
@@ -1271,10 +1915,8 @@ void gentabs ()
 			fputs (_("\n\nMeta-Equivalence Classes:\n"),
 			       stderr);
 
-		out_str_dec (get_int32_decl (), "yy_meta", numecs + 1);
-		buf_prints (&yydmap_buf,
-			    "\t{YYTD_ID_META, (void**)&yy_meta, sizeof(%s)},\n",
-			    "flex_int32_t");
+		out_table ("flex_int32_t", "yy_meta", numecs + 1);
+		yytbl_dmap_add (YYTD_ID_META, "yy_meta", "flex_int32_t");
 
 		for (i = 1; i <= numecs; ++i) {
 			if (trace)
@@ -1300,14 +1942,13 @@ void gentabs ()
 	total_states = lastdfa + numtemps;
 
 	/* Begin generating yy_base */
-	out_str_dec ((tblend >= INT16_MAX || long_align) ?
-		     get_int32_decl () : get_int16_decl (),
-		     "yy_base", total_states + 1);
-
-	buf_prints (&yydmap_buf,
-		    "\t{YYTD_ID_BASE, (void**)&yy_base, sizeof(%s)},\n",
-		    (tblend >= INT16_MAX
-		     || long_align) ? "flex_int32_t" : "flex_int16_t");
+	out_table ((tblend >= INT16_MAX || long_align) ?
+		   "flex_int32_t" : "flex_int16_t",
+		   "yy_base", total_states + 1);
+
+	yytbl_dmap_add (YYTD_ID_BASE, "yy_base",
+			(tblend >= INT16_MAX || long_align) ?
+			"flex_int32_t" : "flex_int16_t");
 	yybase_tbl =
 		(struct yytbl_data *) calloc (1,
 					      sizeof (struct yytbl_data));
@@ -1359,14 +2000,13 @@ void gentabs ()
 
 
 	/* Begin generating yy_def */
-	out_str_dec ((total_states >= INT16_MAX || long_align) ?
-		     get_int32_decl () : get_int16_decl (),
-		     "yy_def", total_states + 1);
+	out_table ((total_states >= INT16_MAX || long_align) ?
+		   "flex_int32_t" : "flex_int16_t",
+		   "yy_def", total_states + 1);
 
-	buf_prints (&yydmap_buf,
-		    "\t{YYTD_ID_DEF, (void**)&yy_def, sizeof(%s)},\n",
-		    (total_states >= INT16_MAX
-		     || long_align) ? "flex_int32_t" : "flex_int16_t");
+	yytbl_dmap_add (YYTD_ID_DEF, "yy_def",
+			(total_states >= INT16_MAX || long_align) ?
+			"flex_int32_t" : "flex_int16_t");
 
 	yydef_tbl =
 		(struct yytbl_data *) calloc (1,
@@ -1393,14 +2033,13 @@ void gentabs ()
 
 
 	/* Begin generating yy_nxt */
-	out_str_dec ((total_states >= INT16_MAX || long_align) ?
-		     get_int32_decl () : get_int16_decl (), "yy_nxt",
-		     tblend + 1);
+	out_table ((total_states >= INT16_MAX || long_align) ?
+		   "flex_int32_t" : "flex_int16_t", "yy_nxt",
+		   tblend + 1);
 
-	buf_prints (&yydmap_buf,
-		    "\t{YYTD_ID_NXT, (void**)&yy_nxt, sizeof(%s)},\n",
-		    (total_states >= INT16_MAX
-		     || long_align) ? "flex_int32_t" : "flex_int16_t");
+	yytbl_dmap_add (YYTD_ID_NXT, "yy_nxt",
+			(total_states >= INT16_MAX || long_align) ?
+			"flex_int32_t" : "flex_int16_t");
 
 	yynxt_tbl =
 		(struct yytbl_data *) calloc (1,
@@ -1432,14 +2071,13 @@ void gentabs ()
 	/* End generating yy_nxt */
 
 	/* Begin generating yy_chk */
-	out_str_dec ((total_states >= INT16_MAX || long_align) ?
-		     get_int32_decl () : get_int16_decl (), "yy_chk",
-		     tblend + 1);
+	out_table ((total_states >= INT16_MAX || long_align) ?
+		   "flex_int32_t" : "flex_int16_t", "yy_chk",
+		   tblend + 1);
 
-	buf_prints (&yydmap_buf,
-		    "\t{YYTD_ID_CHK, (void**)&yy_chk, sizeof(%s)},\n",
-		    (total_states >= INT16_MAX
-		     || long_align) ? "flex_int32_t" : "flex_int16_t");
+	yytbl_dmap_add (YYTD_ID_CHK, "yy_chk",
+			(total_states >= INT16_MAX || long_align) ?
+			"flex_int32_t" : "flex_int16_t");
 
 	yychk_tbl =
 		(struct yytbl_data *) calloc (1,
@@ -1588,6 +2226,12 @@ void make_tables ()
 		indent_put2s ("%s yy_nxt;", trans_offset_type);
 		indent_puts ("};");
 		indent_down ();
+
+		/* yy_transition needs the struct in the tables file too. */
+		if (tables_source_out)
+			fprintf (tables_source_out,
+				 "struct yy_trans_info\n\t{\n\t%s yy_verify;\n\t%s yy_nxt;\n\t};\n\n",
+				 trans_offset_type, trans_offset_type);
 	}
 	else {
 		/* We generate a bogus 'struct yy_trans_info' data type
@@ -1659,9 +2303,15 @@ void make_tables ()
 			}
 		}
 	}
-	else
+	else if (lazy_dfa)
+		genlazy ();
+	else {
 		gentabs ();
 
+		if (hybrid_size > 0)
+			genhybrid ();
+	}
+
 	if (do_yylineno) {
 
 		geneoltbl ();
@@ -1697,10 +2347,9 @@ void make_tables ()
 		/* Begin generating yy_NUL_trans */
 		out_str_dec (get_state_decl (), "yy_NUL_trans",
 			     lastdfa + 1);
-		buf_prints (&yydmap_buf,
-			    "\t{YYTD_ID_NUL_TRANS, (void**)&yy_NUL_trans, sizeof(%s)},\n",
-			    (fullspd) ? "struct yy_trans_info*" :
-			    "flex_int32_t");
+		yytbl_dmap_add (YYTD_ID_NUL_TRANS, "yy_NUL_trans",
+				(fullspd) ?
+				"struct yy_trans_info*" : "flex_int32_t");
 
 		yynultrans_tbl =
 			(struct yytbl_data *) calloc (1,
@@ -1739,16 +2388,22 @@ void make_tables ()
 		/* End generating yy_NUL_trans */
 	}
 
+	if (skip_loops)
+		genskip ();
+
+	if (profile_gen_file)
+		genprofile ();
+
 	if (!C_plus_plus && !reentrant) {
 		indent_puts ("extern int yy_flex_debug;");
 		indent_put2s ("int yy_flex_debug = %s;\n",
 			      ddebug ? "1" : "0");
 	}
 
-	if (ddebug) {		/* Spit out table mapping rules to line numbers. */
-		out_str_dec (long_align ? get_int32_decl () :
-			     get_int16_decl (), "yy_rule_linenum",
-			     num_rules);
+	if (ddebug || profile_counters) {	/* Spit out table mapping rules to line numbers. */
+		out_table (long_align ? "flex_int32_t" :
+			   "flex_int16_t", "yy_rule_linenum",
+			   num_rules);
 		for (i = 1; i < num_rules; ++i)
 			mkdata (rule_linenum[i]);
 		dataend ();
@@ -1778,7 +2433,7 @@ void make_tables ()
 
 		outn ("#define REJECT \\");
 		outn ("{ \\");
-		outn ("*yy_cp = YY_G(yy_hold_char); /* undo effects of setting up yytext */ \\");
+		outn ("YY_RESTORE_HOLD_CHAR /* undo effects of setting up yytext */ \\");
 		outn ("yy_cp = YY_G(yy_full_match); /* restore poss. backed-over text */ \\");
 
 		if (variable_trailing_context_rules) {
@@ -1928,6 +2583,10 @@ void make_tables ()
 		indent_puts ("\t\t(yytext[yyleng - 1] == '\\n'); \\");
 		indent_down ();
 	}
+	if (profile_counters) {
+		indent_puts ("++YY_G(yy_prof_matches)[yy_act]; \\");
+		indent_puts ("YY_G(yy_prof_bytes)[yy_act] += yyleng; \\");
+	}
 	indent_puts ("YY_USER_ACTION");
 	indent_down ();
 
@@ -1956,10 +2615,25 @@ void make_tables ()
 
 	skelout ();		/* %% [9.0] - break point in skel */
 
+	if (lazy_dfa) {
+		/* Only start over with an empty cache between tokens, so
+		 * the states the match in progress has saved stay valid.
+		 */
+		indent_puts
+			("if ( YY_G(yy_lazy)->yy_num_states > YY_LAZY_CACHE_SIZE )");
+		indent_up ();
+		indent_puts ("yy_lazy_flush( M4_YY_CALL_ONLY_ARG );");
+		indent_down ();
+		outc ('\n');
+	}
+
 	gen_start_state ();
 
 	/* Note, don't use any indentation. */
 	outn ("yy_match:");
+	if (zero_copy)
+		indent_puts
+			("yy_ep = &YY_CURRENT_BUFFER_LVALUE->yy_ch_buf[YY_G(yy_n_chars)];");
 	gen_next_match ();
 
 	skelout ();		/* %% [10.0] - break point in skel */
@@ -2010,6 +2684,15 @@ void make_tables ()
 			indent_puts
 				("         \"(\\\"\" << yytext << \"\\\")\\n\";");
 		}
+		else if (zero_copy) {
+			/* yytext isn't NUL-terminated. */
+			indent_puts
+				("fprintf( stderr, \"--accepting rule at line %ld (\\\"%.*s\\\")\\n\",");
+
+			indent_puts
+				("         (long)yy_rule_linenum[yy_act], (int) yyleng, yytext );");
+		}
+
 		else {
 			indent_puts
 				("fprintf( stderr, \"--accepting rule at line %ld (\\\"%s\\\")\\n\",");
@@ -2028,6 +2711,12 @@ void make_tables ()
 			indent_puts
 				("std::cerr << \"--accepting default rule (\\\"\" << yytext << \"\\\")\\n\";");
 		}
+		else if (zero_copy) {
+			indent_puts
+				("fprintf( stderr, \"--accepting default rule (\\\"%.*s\\\")\\n\",");
+			indent_puts ("         (int) yyleng, yytext );");
+		}
+
 		else {
 			indent_puts
 				("fprintf( stderr, \"--accepting default rule (\\\"%s\\\")\\n\",");
@@ -0,0 +1,776 @@
+/* m4 - expand the scanner's m4 macros within flex */
+
+/*  This file is part of flex. */
+
+/*  Redistribution and use in source and binary forms, with or without */
+/*  modification, are permitted provided that the following conditions */
+/*  are met: */
+
+/*  1. Redistributions of source code must retain the above copyright */
+/*     notice, this list of conditions and the following disclaimer. */
+/*  2. Redistributions in binary form must reproduce the above copyright */
+/*     notice, this list of conditions and the following disclaimer in the */
+/*     documentation and/or other materials provided with the distribution. */
+
+/*  Neither the name of the University nor the names of its contributors */
+/*  may be used to endorse or promote products derived from this software */
+/*  without specific prior written permission. */
+
+/*  THIS SOFTWARE IS PROVIDED ``AS IS'' AND WITHOUT ANY EXPRESS OR */
+/*  IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED */
+/*  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR */
+/*  PURPOSE. */
+
+/* This is the part of "m4 -P" that the skeleton and the code flex writes
+ * need: quoting, comments, macros with arguments ($0 to $N, $#, $* and $@),
+ * and the builtins m4_define, m4_undefine, m4_ifdef, m4_ifelse, m4_dnl,
+ * m4_changequote and m4_changecom.  It reads and rescans its input the way
+ * m4 does, so the two give the same output.  Any other m4_ name is copied
+ * through as it is.
+ */
+
+#include "flexdef.h"
+
+#define M4_HASH_SIZE 1021	/* buckets in the macro table */
+#define M4_FLUSH_SIZE 8192	/* output held before it's handed on */
+
+/* What m4_token returns besides an ordinary character. */
+#define M4_EOF (-1)		/* no more input */
+#define M4_DONE (-2)		/* a whole token, already dealt with */
+
+#define M4_ISSPACE(c) ((c) == ' ' || (c) == '\t' || (c) == '\n' \
+		       || (c) == '\r' || (c) == '\f' || (c) == '\v')
+#define M4_ISALPHA(c) (((c) >= 'a' && (c) <= 'z') || ((c) >= 'A' && (c) <= 'Z') \
+		       || (c) == '_')
+#define M4_ISDIGIT(c) ((c) >= '0' && (c) <= '9')
+#define M4_ISALNUM(c) (M4_ISALPHA (c) || M4_ISDIGIT (c))
+
+#define M4_PUTC(str, c) \
+	do { \
+		if ((str)->len == (str)->max) \
+			m4_grow ((str), 1); \
+		(str)->s[(str)->len++] = (char) (c); \
+	} while (0)
+
+/* The builtins.  M4_MACRO is a macro defined with m4_define. */
+enum m4_builtin {
+	M4_MACRO, M4_DEFINE, M4_UNDEFINE, M4_IFDEF, M4_IFELSE, M4_DNL,
+	M4_CHANGEQUOTE, M4_CHANGECOM
+};
+
+/* A growable string. */
+struct m4_str {
+	char   *s;
+	int     len, max;
+};
+
+/* Input still to be read: the text given to m4_push, or what a macro
+ * expanded to, which is read before whatever follows the macro call.
+ */
+struct m4_input {
+	const char *text;
+	int     pos, len;
+	char   *owned;		/* freed when the text has been read */
+	struct m4_input *next;
+};
+
+struct m4_macro {
+	char   *name;
+	char   *value;		/* for M4_MACRO */
+	int     builtin;
+	bool    blind;		/* only a macro when followed by '(' */
+	struct m4_macro *next;
+};
+
+/* A macro call's arguments, each ended by a NUL in text. */
+struct m4_args {
+	struct m4_str text;
+	int    *start;
+	int     n, max;
+};
+
+struct m4 {
+	struct m4_input *input, *spare;
+	struct m4_macro *macros[M4_HASH_SIZE];
+	struct m4_macro *dead;	/* undefined, but maybe still being called */
+	char   *lquote, *rquote;	/* "" if quoting is off */
+	char   *bcomm, *ecomm;	/* "" if comments are off */
+	struct m4_str out, word;
+	void    (*emit) PROTO ((void *, const char *, int));
+	void   *emit_arg;
+};
+
+static void m4_grow PROTO ((struct m4_str *, int));
+static void m4_puts PROTO ((struct m4_str *, const char *, int));
+static int m4_getc PROTO ((struct m4 *));
+static int m4_peekc PROTO ((struct m4 *));
+static bool m4_match PROTO ((struct m4 *, const char *));
+static void m4_push_owned PROTO ((struct m4 *, struct m4_str *));
+static unsigned int m4_hash PROTO ((const char *));
+static struct m4_macro *m4_lookup PROTO ((struct m4 *, const char *));
+static struct m4_macro *m4_install
+PROTO ((struct m4 *, const char *, int, bool));
+static void m4_remove PROTO ((struct m4 *, const char *));
+static void m4_free_macros PROTO ((struct m4_macro *));
+static char *m4_strdup PROTO ((const char *));
+static void m4_set PROTO ((char **, const char *));
+static int m4_token PROTO ((struct m4 *, struct m4_str *));
+static void m4_string PROTO ((struct m4 *, struct m4_str *));
+static void m4_comment PROTO ((struct m4 *, struct m4_str *));
+static void m4_word PROTO ((struct m4 *, int, struct m4_str *));
+static void m4_newarg PROTO ((struct m4_args *));
+static void m4_collect PROTO ((struct m4 *, struct m4_args *));
+static void m4_call PROTO ((struct m4 *, struct m4_macro *));
+static void m4_expand_macro
+PROTO ((struct m4 *, struct m4_macro *, int, char **));
+static void m4_plain PROTO ((struct m4 *));
+static void m4_flush PROTO ((struct m4 *, bool));
+
+
+/** Create an expander with m4's defaults: ` and ' quotes, # comments, and
+ *  only the builtins defined.
+ *  @param emit called with the expanded output, a number of whole lines
+ *         at a time except for the very end of it
+ *  @param emit_arg passed on to emit
+ *  @return the new expander
+ */
+struct m4 *m4_create (void (*emit) (void *, const char *, int),
+		      void *emit_arg)
+{
+	struct m4 *m;
+
+	m = (struct m4 *) flex_alloc (sizeof (struct m4));
+	if (!m)
+		flexerror (_("flex_alloc failed in m4_create"));
+	memset (m, 0, sizeof (*m));
+
+	m->emit = emit;
+	m->emit_arg = emit_arg;
+	m->lquote = m4_strdup ("`");
+	m->rquote = m4_strdup ("'");
+	m->bcomm = m4_strdup ("#");
+	m->ecomm = m4_strdup ("\n");
+
+	m4_install (m, "m4_define", M4_DEFINE, true);
+	m4_install (m, "m4_undefine", M4_UNDEFINE, true);
+	m4_install (m, "m4_ifdef", M4_IFDEF, true);
+	m4_install (m, "m4_ifelse", M4_IFELSE, true);
+	m4_install (m, "m4_dnl", M4_DNL, false);
+	m4_install (m, "m4_changequote", M4_CHANGEQUOTE, false);
+	m4_install (m, "m4_changecom", M4_CHANGECOM, false);
+
+	return m;
+}
+
+/** Free an expander and everything it holds. */
+void m4_destroy (struct m4 *m)
+{
+	struct m4_input *in;
+	int     i;
+
+	while (m4_getc (m) != EOF) ;
+	while ((in = m->spare) != NULL) {
+		m->spare = in->next;
+		flex_free (in);
+	}
+
+	for (i = 0; i < M4_HASH_SIZE; ++i)
+		m4_free_macros (m->macros[i]);
+	m4_free_macros (m->dead);
+
+	flex_free (m->lquote);
+	flex_free (m->rquote);
+	flex_free (m->bcomm);
+	flex_free (m->ecomm);
+	if (m->out.s)
+		flex_free (m->out.s);
+	if (m->word.s)
+		flex_free (m->word.s);
+	flex_free (m);
+}
+
+/** Define a macro, as m4_define([[name]], [[value]]) would. */
+void m4_define (struct m4 *m, const char *name, const char *value)
+{
+	struct m4_macro *mac;
+
+	mac = m4_install (m, name, M4_MACRO, false);
+	mac->value = m4_strdup (value ? value : "");
+}
+
+/** Change the quotes, as m4_changequote would; "" turns quoting off. */
+void m4_set_quotes (struct m4 *m, const char *lq, const char *rq)
+{
+	m4_set (&m->lquote, lq);
+	m4_set (&m->rquote, *lq ? rq : "");
+}
+
+/** Change the comment delimiters, as m4_changecom would; "" turns comments
+ *  off.
+ */
+void m4_set_comments (struct m4 *m, const char *bc, const char *ec)
+{
+	m4_set (&m->bcomm, bc);
+	m4_set (&m->ecomm, *bc ? ec : "");
+}
+
+/** Have the text read next, before any input pushed earlier.  The text is
+ *  not copied, so it must stay put until m4_run is done with it.
+ */
+void m4_push (struct m4 *m, const char *text, int len)
+{
+	struct m4_input *in;
+
+	if (len <= 0)
+		return;
+
+	if ((in = m->spare) != NULL)
+		m->spare = in->next;
+	else {
+		in = (struct m4_input *) flex_alloc (sizeof (struct m4_input));
+		if (!in)
+			flexerror (_("flex_alloc failed in m4_push"));
+	}
+
+	in->text = text;
+	in->pos = 0;
+	in->len = len;
+	in->owned = NULL;
+	in->next = m->input;
+	m->input = in;
+}
+
+/** Expand all of the input, handing the result to the emit function. */
+void m4_run (struct m4 *m)
+{
+	int     c;
+
+	while ((c = m4_token (m, &m->out)) != M4_EOF) {
+		if (c >= 0) {
+			M4_PUTC (&m->out, c);
+			m4_plain (m);
+		}
+		if (m->out.len >= M4_FLUSH_SIZE)
+			m4_flush (m, false);
+	}
+
+	m4_flush (m, true);
+}
+
+/* Copy the input that follows up to where a word, quote or comment could
+ * start straight to the output, as there's nothing in it to expand.  Most
+ * of a scanner's tables go this way.
+ */
+static void m4_plain (struct m4 *m)
+{
+	struct m4_input *in = m->input;
+	const char *start, *p, *end;
+	char    lq = m->lquote[0], bc = m->bcomm[0];
+
+	if (!in)
+		return;
+
+	start = p = in->text + in->pos;
+	end = in->text + MIN (in->len, in->pos + M4_FLUSH_SIZE);
+
+	while (p < end && !M4_ISALPHA (*p) && *p != lq && *p != bc)
+		++p;
+
+	m4_puts (&m->out, start, p - start);
+	in->pos += p - start;
+}
+
+/* Hand on the output up to its last newline, or all of it if at_end. */
+static void m4_flush (struct m4 *m, bool at_end)
+{
+	int     n = m->out.len;
+
+	if (!at_end)
+		while (n > 0 && m->out.s[n - 1] != '\n')
+			--n;
+
+	if (n == 0)
+		return;
+
+	m->emit (m->emit_arg, m->out.s, n);
+	memmove (m->out.s, m->out.s + n, m->out.len - n);
+	m->out.len -= n;
+}
+
+/* Make room in str for n more characters. */
+static void m4_grow (struct m4_str *str, int n)
+{
+	if (str->len + n <= str->max)
+		return;
+
+	str->max = str->max ? str->max * 2 : 256;
+	while (str->len + n > str->max)
+		str->max *= 2;
+
+	str->s = str->s ? (char *) flex_realloc (str->s, str->max)
+		: (char *) flex_alloc (str->max);
+	if (!str->s)
+		flexerror (_("flex_alloc failed in m4_grow"));
+}
+
+static void m4_puts (struct m4_str *str, const char *s, int n)
+{
+	m4_grow (str, n);
+	memcpy (str->s + str->len, s, n);
+	str->len += n;
+}
+
+static char *m4_strdup (const char *s)
+{
+	char   *copy = (char *) flex_alloc (strlen (s) + 1);
+
+	if (!copy)
+		flexerror (_("flex_alloc failed in m4_strdup"));
+	return strcpy (copy, s);
+}
+
+static void m4_set (char **delim, const char *s)
+{
+	flex_free (*delim);
+	*delim = m4_strdup (s);
+}
+
+/* The next input character, or EOF. */
+static int m4_getc (struct m4 *m)
+{
+	struct m4_input *in;
+
+	while ((in = m->input) != NULL) {
+		if (in->pos < in->len)
+			return (unsigned char) in->text[in->pos++];
+
+		m->input = in->next;
+		if (in->owned)
+			flex_free (in->owned);
+		in->next = m->spare;
+		m->spare = in;
+	}
+
+	return EOF;
+}
+
+/* The next input character, left to be read again, or EOF. */
+static int m4_peekc (struct m4 *m)
+{
+	int     c = m4_getc (m);
+
+	if (c != EOF)
+		--m->input->pos;
+	return c;
+}
+
+/* If the input goes on with s, read past it and return true. */
+static bool m4_match (struct m4 *m, const char *s)
+{
+	struct m4_input *in = m->input;
+	int     pos = in ? in->pos : 0, i;
+
+	for (i = 0; s[i]; ++i, ++pos) {
+		while (in && pos >= in->len)
+			if ((in = in->next) != NULL)
+				pos = in->pos;
+
+		if (!in || in->text[pos] != s[i])
+			return false;
+	}
+
+	while (i-- > 0)
+		m4_getc (m);
+	return true;
+}
+
+/* Have what's in str read next; str gives up its text. */
+static void m4_push_owned (struct m4 *m, struct m4_str *str)
+{
+	if (str->len == 0) {
+		if (str->s)
+			flex_free (str->s);
+		return;
+	}
+
+	m4_push (m, str->s, str->len);
+	m->input->owned = str->s;
+}
+
+static unsigned int m4_hash (const char *name)
+{
+	unsigned int h = 0;
+
+	while (*name)
+		h = h * 31 + (unsigned char) *name++;
+	return h % M4_HASH_SIZE;
+}
+
+static struct m4_macro *m4_lookup (struct m4 *m, const char *name)
+{
+	struct m4_macro *mac;
+
+	for (mac = m->macros[m4_hash (name)]; mac; mac = mac->next)
+		if (strcmp (mac->name, name) == 0)
+			return mac;
+	return NULL;
+}
+
+/* Add a macro, in place of any macro of that name.  The old one may be in
+ * the middle of a call, so it's kept until the expander goes.
+ */
+static struct m4_macro *m4_install (struct m4 *m, const char *name,
+				    int builtin, bool blind)
+{
+	struct m4_macro *mac;
+	unsigned int h = m4_hash (name);
+
+	m4_remove (m, name);
+
+	mac = (struct m4_macro *) flex_alloc (sizeof (struct m4_macro));
+	if (!mac)
+		flexerror (_("flex_alloc failed in m4_install"));
+	mac->name = m4_strdup (name);
+	mac->value = NULL;
+	mac->builtin = builtin;
+	mac->blind = blind;
+	mac->next = m->macros[h];
+	m->macros[h] = mac;
+	return mac;
+}
+
+static void m4_remove (struct m4 *m, const char *name)
+{
+	struct m4_macro **p, *mac;
+
+	for (p = &m->macros[m4_hash (name)]; (mac = *p) != NULL;
+	     p = &mac->next)
+		if (strcmp (mac->name, name) == 0) {
+			*p = mac->next;
+			mac->next = m->dead;
+			m->dead = mac;
+			return;
+		}
+}
+
+static void m4_free_macros (struct m4_macro *mac)
+{
+	struct m4_macro *next;
+
+	for (; mac; mac = next) {
+		next = mac->next;
+		flex_free (mac->name);
+		if (mac->value)
+			flex_free (mac->value);
+		flex_free (mac);
+	}
+}
+
+/* Read a token.  Quoted strings, comments and words that aren't macros go
+ * to dest, and a macro call is expanded, all of which returns M4_DONE.  Any
+ * other character is returned for the caller to deal with.
+ */
+static int m4_token (struct m4 *m, struct m4_str *dest)
+{
+	int     c = m4_getc (m);
+
+	if (c == EOF)
+		return M4_EOF;
+
+	if (c == (unsigned char) m->bcomm[0] && *m->bcomm
+	    && m4_match (m, m->bcomm + 1)) {
+		m4_comment (m, dest);
+		return M4_DONE;
+	}
+
+	if (M4_ISALPHA (c)) {
+		m4_word (m, c, dest);
+		return M4_DONE;
+	}
+
+	if (c == (unsigned char) m->lquote[0] && *m->lquote
+	    && m4_match (m, m->lquote + 1)) {
+		m4_string (m, dest);
+		return M4_DONE;
+	}
+
+	return c;
+}
+
+/* Copy a quoted string without its outer quotes; the opening one has been
+ * read.
+ */
+static void m4_string (struct m4 *m, struct m4_str *dest)
+{
+	int     depth = 1, c;
+
+	for (;;) {
+		if ((c = m4_getc (m)) == EOF)
+			flexerror (_("m4: end of file in string"));
+
+		if (c == (unsigned char) m->rquote[0]
+		    && m4_match (m, m->rquote + 1)) {
+			if (--depth == 0)
+				return;
+			m4_puts (dest, m->rquote, strlen (m->rquote));
+		}
+		else if (c == (unsigned char) m->lquote[0]
+			 && m4_match (m, m->lquote + 1)) {
+			++depth;
+			m4_puts (dest, m->lquote, strlen (m->lquote));
+		}
+		else
+			M4_PUTC (dest, c);
+	}
+}
+
+/* Copy a comment, delimiters and all; the opening one has been read. */
+static void m4_comment (struct m4 *m, struct m4_str *dest)
+{
+	int     c;
+
+	m4_puts (dest, m->bcomm, strlen (m->bcomm));
+
+	for (;;) {
+		if ((c = m4_getc (m)) == EOF)
+			flexerror (_("m4: end of file in comment"));
+
+		if (c == (unsigned char) m->ecomm[0]
+		    && m4_match (m, m->ecomm + 1)) {
+			m4_puts (dest, m->ecomm, strlen (m->ecomm));
+			return;
+		}
+
+		M4_PUTC (dest, c);
+	}
+}
+
+/* Read the rest of a word that starts with c, and expand it if it's a
+ * macro.
+ */
+static void m4_word (struct m4 *m, int c, struct m4_str *dest)
+{
+	struct m4_macro *mac;
+
+	m->word.len = 0;
+	M4_PUTC (&m->word, c);
+	while ((c = m4_peekc (m)) != EOF && M4_ISALNUM (c))
+		M4_PUTC (&m->word, m4_getc (m));
+	M4_PUTC (&m->word, '\0');
+
+	if ((mac = m4_lookup (m, m->word.s)) == NULL
+	    || (mac->blind && c != '('))
+		m4_puts (dest, m->word.s, m->word.len - 1);
+	else
+		m4_call (m, mac);
+}
+
+/* Start the next argument. */
+static void m4_newarg (struct m4_args *args)
+{
+	if (args->n > 0)
+		M4_PUTC (&args->text, '\0');
+
+	if (args->n == args->max) {
+		args->max = args->max ? args->max * 2 : 8;
+		args->start = args->start
+			? (int *) flex_realloc (args->start,
+						args->max * sizeof (int))
+			: (int *) flex_alloc (args->max * sizeof (int));
+		if (!args->start)
+			flexerror (_("flex_alloc failed in m4_newarg"));
+	}
+
+	args->start[args->n++] = args->text.len;
+}
+
+/* Collect a macro call's arguments, expanded; the '(' has been read.  Each
+ * argument's leading white space is dropped, as are the quotes around
+ * quoted text.
+ */
+static void m4_collect (struct m4 *m, struct m4_args *args)
+{
+	int     depth = 0, c;
+	bool    leading = true;
+
+	m4_newarg (args);
+
+	for (;;) {
+		if ((c = m4_token (m, &args->text)) == M4_EOF)
+			flexerror (_("m4: end of file in argument list"));
+
+		if (c == M4_DONE) {
+			leading = false;
+			continue;
+		}
+
+		if (leading && M4_ISSPACE (c))
+			continue;
+		leading = false;
+
+		if (c == '(')
+			++depth;
+		else if (c == ')') {
+			if (depth == 0)
+				break;
+			--depth;
+		}
+		else if (c == ',' && depth == 0) {
+			m4_newarg (args);
+			leading = true;
+			continue;
+		}
+
+		M4_PUTC (&args->text, c);
+	}
+
+	M4_PUTC (&args->text, '\0');
+}
+
+/* Call mac, with the arguments that follow it if there's a '('. */
+static void m4_call (struct m4 *m, struct m4_macro *mac)
+{
+	struct m4_args args;
+	char  **argv = NULL;
+	int     i;
+
+	memset (&args, 0, sizeof (args));
+
+	if (m4_peekc (m) == '(') {
+		m4_getc (m);
+		m4_collect (m, &args);
+
+		argv = (char **) flex_alloc (args.n * sizeof (char *));
+		if (!argv)
+			flexerror (_("flex_alloc failed in m4_call"));
+		for (i = 0; i < args.n; ++i)
+			argv[i] = args.text.s + args.start[i];
+	}
+
+	m4_expand_macro (m, mac, args.n, argv);
+
+	if (argv)
+		flex_free (argv);
+	if (args.start)
+		flex_free (args.start);
+	if (args.text.s)
+		flex_free (args.text.s);
+}
+
+/* Expand mac with its argc arguments in argv.  Whatever it expands to is
+ * pushed back to be read again.
+ */
+static void m4_expand_macro (struct m4 *m, struct m4_macro *mac, int argc,
+			     char **argv)
+{
+	struct m4_str result;
+	const char *v;
+	int     i, n, c;
+
+	memset (&result, 0, sizeof (result));
+
+	switch (mac->builtin) {
+	case M4_MACRO:
+		for (v = mac->value; *v; ++v) {
+			if (*v != '$' || !(M4_ISDIGIT (v[1]) || v[1] == '#'
+					   || v[1] == '*' || v[1] == '@')) {
+				M4_PUTC (&result, *v);
+				continue;
+			}
+
+			++v;
+			if (*v == '#') {
+				char    num[32];
+
+				snprintf (num, sizeof (num), "%d", argc);
+				m4_puts (&result, num, strlen (num));
+			}
+			else if (*v == '*' || *v == '@')
+				for (i = 0; i < argc; ++i) {
+					if (i > 0)
+						M4_PUTC (&result, ',');
+					if (*v == '@')
+						m4_puts (&result, m->lquote,
+							 strlen (m->lquote));
+					m4_puts (&result, argv[i],
+						 strlen (argv[i]));
+					if (*v == '@')
+						m4_puts (&result, m->rquote,
+							 strlen (m->rquote));
+				}
+			else {
+				for (n = 0; M4_ISDIGIT (*v); ++v)
+					n = n * 10 + v[0] - '0';
+				--v;
+
+				if (n == 0)
+					m4_puts (&result, mac->name,
+						 strlen (mac->name));
+				else if (n <= argc)
+					m4_puts (&result, argv[n - 1],
+						 strlen (argv[n - 1]));
+			}
+		}
+		break;
+
+	case M4_DEFINE:
+		if (argc >= 1)
+			m4_define (m, argv[0], argc >= 2 ? argv[1] : "");
+		break;
+
+	case M4_UNDEFINE:
+		for (i = 0; i < argc; ++i)
+			m4_remove (m, argv[i]);
+		break;
+
+	case M4_IFDEF:
+		if (argc >= 2) {
+			v = m4_lookup (m, argv[0]) ? argv[1]
+				: argc >= 3 ? argv[2] : "";
+			m4_puts (&result, v, strlen (v));
+		}
+		break;
+
+	case M4_IFELSE:
+		/* ifelse(a,b,c) is c if a and b are the same; with a fourth
+		 * argument, that's what it is otherwise, and with five or more,
+		 * the first three are dropped and the rest tried the same way.
+		 */
+		if (argc < 3)
+			break;
+		for (v = NULL; !v; argv += 3, argc -= 3)
+			if (strcmp (argv[0], argv[1]) == 0)
+				v = argv[2];
+			else if (argc == 3)
+				break;
+			else if (argc <= 5)
+				v = argv[3];
+		if (v)
+			m4_puts (&result, v, strlen (v));
+		break;
+
+	case M4_DNL:
+		while ((c = m4_getc (m)) != EOF && c != '\n') ;
+		break;
+
+	case M4_CHANGEQUOTE:
+		if (argc == 0)
+			m4_set_quotes (m, "`", "'");
+		else
+			m4_set_quotes (m, argv[0],
+				       argc >= 2 && *argv[1] ? argv[1] : "'");
+		break;
+
+	case M4_CHANGECOM:
+		if (argc == 0)
+			m4_set_comments (m, "", "");
+		else
+			m4_set_comments (m, argv[0],
+					 argc >= 2 && *argv[1] ? argv[1] : "\n");
+		break;
+	}
+
+	m4_push_owned (m, &result);
+}
+
+/* vim:set expandtab cindent tabstop=4 softtabstop=4 shiftwidth=4 textwidth=0: */
@@ -45,15 +45,23 @@ void flexinit PROTO ((int, char **));
 void readin PROTO ((void));
 void set_up_initial_allocations PROTO ((void));
 static char *basename2 PROTO ((char *path, int should_strip_ext));
+static double phase_clock PROTO ((void));
+static long phase_rss PROTO ((int));
+static double child_cpu PROTO ((void));
+static void stats_report PROTO ((void));
 
 
 /* these globals are all defined and commented in flexdef.h */
-int     printstats, syntaxerror, eofseen, ddebug, trace, nowarn, spprdflt;
+int     printstats, stats_json, syntaxerror, eofseen, ddebug, trace, nowarn,
+	spprdflt, external_m4;
 int     interactive, lex_compat, posix_compat, do_yylineno,
 	useecs, fulltbl, usemecs;
-int     fullspd, gen_line_dirs, performance_report, backing_up_report;
+int     fullspd, directcode, packtbl, gen_line_dirs, performance_report,
+	backing_up_report;
 int     C_plus_plus, long_align, use_read, yytext_is_array, do_yywrap,
-	csize;
+	csize, zero_copy, read_ahead, token_batch, push_scanner, parallel_scan,
+	skip_loops, lazy_dfa, utf8, profile_counters, dfa_threads, hybrid_size,
+	minimize;
 int     reentrant, bison_bridge_lval, bison_bridge_lloc;
 int     yymore_used, reject, real_reject, continued_action, in_rule;
 int     yymore_really_used, reject_really_used;
@@ -64,6 +72,10 @@ char   *action_array;
 int     action_size, defs1_offset, prolog_offset, action_offset,
 	action_index;
 char   *infilename = NULL, *outfilename = NULL, *headerfilename = NULL;
+char   *profile_gen_file = NULL, *profile_use_file = NULL;
+char   *tables_source_name = NULL;
+FILE   *tables_source_out = NULL;
+static char *tables_bundle_name = NULL;
 int     did_outfilename;
 char   *prefix, *yyclass, *extra_type = NULL;
 int     do_stdinit, use_stdout;
@@ -94,12 +106,14 @@ int     numsnpairs, jambase, jamstate;
 int     lastccl, *cclmap, *ccllen, *cclng, cclreuse;
 int     current_maxccls, current_max_ccl_tbl_size;
 Char   *ccltbl;
+int    *cclrng, *rngfirst, *rnglast, *rngnext, lastrng, current_max_rngs;
 char    nmstr[MAXLINE];
 int     sectnum, nummt, hshcol, dfaeql, numeps, eps2, num_reallocs;
-int     tmpuses, totnst, peakpairs, numuniq, numdup, hshsave;
+int     tmpuses, totnst, peakpairs, numuniq, numdup, hshsave, nummerged;
 int     num_backing_up, bol_needed;
 FILE   *backing_up_file;
 int     end_of_buffer_state;
+int    *skipmode, *skipset, *lazystart, num_full_rows;
 char  **input_files;
 int     num_input_files;
 jmp_buf flex_main_jmp_buf;
@@ -107,7 +121,7 @@ bool   *rule_has_nl, *ccl_has_nl;
 int     nlch = '\n';
 bool    ansi_func_defs, ansi_func_protos;
 
-bool    tablesext, tablesverify, gentables;
+bool    tablesext, tablesverify, gentables, tables_native;
 char   *tablesfilename=0,*tablesname=0;
 struct yytbl_writer tableswr;
 
@@ -143,6 +157,40 @@ const char *escaped_qend   = "[[]]M4_YY_NOOP]M4_YY_NOOP]M4_YY_NOOP[[]]";
 /* For debugging. The max number of filters to apply to skeleton. */
 static int preproc_level = 1000;
 
+/* The top of the --tables-source file: the part of the scanner's prologue
+ * that the table definitions need.
+ */
+static const char *tables_source_head[] = {
+	"/* The tables of a lexical scanner generated by flex */",
+	"",
+	"#if defined (__cplusplus) || defined (__STDC__)",
+	"#define yyconst const",
+	"#else",
+	"#define yyconst",
+	"#endif",
+	"",
+	"#if defined (__STDC_VERSION__) && __STDC_VERSION__ >= 199901L",
+	"#include <inttypes.h>",
+	"typedef uint8_t flex_uint8_t;",
+	"typedef int16_t flex_int16_t;",
+	"typedef int32_t flex_int32_t;",
+	"#else",
+	"typedef unsigned char flex_uint8_t;",
+	"typedef short int flex_int16_t;",
+	"typedef int flex_int32_t;",
+	"#endif",
+	"",
+	NULL
+};
+
+/* Wall time and peak memory of each phase, for --stats=json. */
+static const char *phase_names[NUM_PHASES] = {
+	"setup", "parse", "ecs", "dfa", "minimize", "compress", "tables", "m4"
+};
+static double phase_secs[NUM_PHASES], phase_started;
+static long phase_maxrss[NUM_PHASES];
+static int cur_phase = -1;
+
 int flex_main PROTO ((int argc, char *argv[]));
 int main PROTO ((int argc, char *argv[]));
 
@@ -161,6 +209,8 @@ int flex_main (argc, argv)
 	 */
 	exit_status = setjmp (flex_main_jmp_buf);
 	if (exit_status){
+        /* Whatever the filter chain still has to do happens now. */
+        phase_mark (PHASE_M4);
         if (stdout && !_stdout_closed && !ferror(stdout)){
             fflush(stdout);
             fclose(stdout);
@@ -175,16 +225,24 @@ int flex_main (argc, argv)
 
             }
         }
+        phase_mark (NUM_PHASES);
+        if (stats_json && exit_status == 1)
+            stats_report ();
         return exit_status - 1;
     }
 
+	phase_mark (PHASE_SETUP);
 	flexinit (argc, argv);
 
 	readin ();
 
 	skelout ();
 	/* %% [1.5] DFA */
-	ntod ();
+	phase_mark (PHASE_DFA);
+	if (lazy_dfa)
+		mklazy ();
+	else
+		ntod ();
 
 	for (i = 1; i <= num_rules; ++i)
 		if (!rule_useful[i] && i != default_rule)
@@ -197,6 +255,7 @@ int flex_main (argc, argv)
 			      rule_linenum[default_rule]);
 
 	/* Generate the C state transition tables from the DFA. */
+	phase_mark (PHASE_TABLES);
 	make_tables ();
 
 	/* Note, flexend does not return.  It exits with its argument
@@ -255,6 +314,14 @@ void check_options ()
 		reject_really_used = true;
 #endif
 
+	if (utf8) {
+		if (csize == 128)
+			flexerror (_("--utf8 and -7 are incompatible"));
+
+		/* Every byte can show up in UTF-8 text. */
+		csize = CSIZE;
+	}
+
 	if (csize == unspecified) {
 		if ((fulltbl || fullspd) && !useecs)
 			csize = DEFAULT_CSIZE;
@@ -285,8 +352,19 @@ void check_options ()
 		if (fulltbl && fullspd)
 			flexerror (_
 				   ("-Cf and -CF are mutually exclusive"));
+
+		if (directcode)
+			flexerror (_
+				   ("-Cg and -Cf/-CF are mutually exclusive"));
+
+		if (packtbl)
+			flexerror (_
+				   ("-Cx and -Cf/-CF are mutually exclusive"));
 	}
 
+	if (directcode && tablesext)
+		flexerror (_("-Cg and --tables-file are incompatible"));
+
 	if (C_plus_plus && fullspd)
 		flexerror (_("Can't use -+ with -CF option"));
 
@@ -301,6 +379,94 @@ void check_options ()
 	if (C_plus_plus && bison_bridge_lval)
 		flexerror (_("bison bridge not supported for the C++ scanner."));
 
+	if (C_plus_plus && zero_copy)
+		flexerror (_("zero-copy scanning not supported for the C++ scanner."));
+
+	if (zero_copy && yytext_is_array)
+		flexerror (_("%array and --zero-copy are incompatible"));
+
+	if (C_plus_plus && read_ahead)
+		flexerror (_("read-ahead not supported for the C++ scanner."));
+
+	if (parallel_scan) {
+		if (!reentrant)
+			flexerror (_("--parallel requires --reentrant"));
+		if (!zero_copy)
+			flexerror (_("--parallel requires --zero-copy"));
+
+		/* The parallel scanner collects its tokens with yylex_batch(). */
+		token_batch = true;
+	}
+
+	if (C_plus_plus && token_batch)
+		flexerror (_("yylex_batch() not supported for the C++ scanner."));
+
+	if (bison_bridge_lval && token_batch)
+		flexerror (_("--bison-bridge and --token-batch are incompatible"));
+
+	if (C_plus_plus && push_scanner)
+		flexerror (_("push scanning not supported for the C++ scanner."));
+
+	if (bison_bridge_lval && push_scanner)
+		flexerror (_("--bison-bridge and --push are incompatible"));
+
+	if (push_scanner && read_ahead)
+		flexerror (_("--push and --readahead are incompatible"));
+
+	if (skip_loops && fullspd)
+		flexerror (_("Can't use --skip-loops with -CF"));
+
+	if (skip_loops && tablesext)
+		flexerror (_("--skip-loops and --tables-file are incompatible"));
+
+	if (lazy_dfa) {
+		if (C_plus_plus)
+			flexerror (_("lazy DFA not supported for the C++ scanner."));
+		if (fulltbl || fullspd)
+			flexerror (_("-Cf/-CF and --lazy-dfa are incompatible"));
+		if (directcode)
+			flexerror (_("-Cg and --lazy-dfa are incompatible"));
+		if (skip_loops)
+			flexerror (_("--skip-loops and --lazy-dfa are incompatible"));
+		if (tablesext)
+			flexerror (_("--lazy-dfa and --tables-file are incompatible"));
+	}
+
+	if (profile_counters && C_plus_plus)
+		flexerror (_("%option profile not supported for the C++ scanner."));
+
+	if (hybrid_size > 0) {
+		if (fulltbl || fullspd)
+			flexerror (_("-Cf/-CF and --hybrid are incompatible"));
+		if (directcode)
+			flexerror (_("-Cg and --hybrid are incompatible"));
+		if (lazy_dfa)
+			flexerror (_("--lazy-dfa and --hybrid are incompatible"));
+		if (tablesext)
+			flexerror (_("--hybrid and --tables-file are incompatible"));
+	}
+
+	if (profile_gen_file || profile_use_file) {
+		if (profile_gen_file && profile_use_file)
+			flexerror (_("--profile-gen and --profile-use are incompatible"));
+		if (profile_gen_file && C_plus_plus)
+			flexerror (_("--profile-gen not supported for the C++ scanner."));
+		if (directcode)
+			flexerror (_("-Cg can't be used with --profile-gen or --profile-use"));
+		if (lazy_dfa)
+			flexerror (_("--lazy-dfa can't be used with --profile-gen or --profile-use"));
+	}
+
+	if (tables_native && !tablesext)
+		flexerror (_("--tables-native requires --tables-file"));
+
+	if (tables_source_name) {
+		if (tablesext)
+			flexerror (_("--tables-source and --tables-file are incompatible"));
+		if (directcode)
+			flexerror (_("-Cg and --tables-source are incompatible"));
+	}
+
 
 	if (useecs) {		/* Set up doubly-linked equivalence classes. */
 
@@ -360,17 +526,25 @@ void check_options ()
 	}
 
 
-    /* Setup the filter chain. */
-    output_chain = filter_create_int(NULL, filter_tee_header, headerfilename);
-    if ( !(m4 = getenv("M4")))
-        m4 = M4;
-    filter_create_ext(output_chain, m4, "-P", 0);
-    filter_create_int(output_chain, filter_fix_linedirs, NULL);
+    /* Setup the filter chain, or have flexend expand the output itself. */
+    if (external_m4) {
+        output_chain = filter_create_int(NULL, filter_tee_header, headerfilename);
+        if ( !(m4 = getenv("M4")))
+            m4 = M4;
+        filter_create_ext(output_chain, m4, "-P", 0);
+        filter_create_int(output_chain, filter_fix_linedirs, NULL);
+    }
 
-    /* For debugging, only run the requested number of filters. */
+    /* For debugging, only run the requested number of filters; without
+     * --external-m4, filter_expand stops where they would have.
+     */
     if (preproc_level > 0) {
-        filter_truncate(output_chain, preproc_level);
-        filter_apply_chain(output_chain);
+        if (external_m4) {
+            filter_truncate(output_chain, preproc_level);
+            filter_apply_chain(output_chain);
+        }
+        else
+            filter_capture();
     }
     yyout = stdout;
 
@@ -412,10 +586,27 @@ void check_options ()
 		snprintf (tablesname, nbytes, "%stables", prefix);
 		yytbl_hdr_init (&hdr, flex_version, tablesname);
 
+		if (tables_native) {
+			flex_uint16_t one = 1;
+
+			tableswr.native = true;
+			hdr.th_flags = YYTH_NATIVE;
+			if (*(char *) &one == 0)
+				hdr.th_flags |= YYTH_BIG_ENDIAN;
+		}
+
 		if (yytbl_hdr_fwrite (&tableswr, &hdr) <= 0)
 			flexerror (_("could not write tables header"));
 	}
 
+	if (tables_source_name) {
+		if ((tables_source_out = fopen (tables_source_name, "w")) == NULL)
+			lerrsf (_("could not create %s"), tables_source_name);
+
+		for (i = 0; tables_source_head[i]; ++i)
+			fprintf (tables_source_out, "%s\n", tables_source_head[i]);
+	}
+
 	if (skelname && (skelfile = fopen (skelname, "r")) == NULL)
 		lerrsf (_("can't open skeleton file %s"), skelname);
 
@@ -439,6 +630,33 @@ void check_options ()
 	if (do_yylineno)
 		buf_m4_define (&m4defs_buf, "M4_YY_USE_LINENO", NULL);
 
+	if (zero_copy)
+		buf_m4_define (&m4defs_buf, "M4_YY_ZERO_COPY", NULL);
+
+	if (read_ahead)
+		buf_m4_define (&m4defs_buf, "M4_YY_READAHEAD", NULL);
+
+	if (token_batch)
+		buf_m4_define (&m4defs_buf, "M4_YY_TOKEN_BATCH", NULL);
+
+	if (push_scanner)
+		buf_m4_define (&m4defs_buf, "M4_YY_PUSH", NULL);
+
+	if (parallel_scan)
+		buf_m4_define (&m4defs_buf, "M4_YY_PARALLEL", NULL);
+
+	if (skip_loops)
+		buf_m4_define (&m4defs_buf, "M4_YY_SKIP_LOOPS", NULL);
+
+	if (lazy_dfa)
+		buf_m4_define (&m4defs_buf, "M4_YY_LAZY_DFA", NULL);
+
+	if (profile_gen_file)
+		buf_m4_define (&m4defs_buf, "M4_YY_PROFILE_GEN", NULL);
+
+	if (profile_counters)
+		buf_m4_define (&m4defs_buf, "M4_YY_PROFILE", NULL);
+
 	/* Create the alignment type. */
 	buf_strdefine (&userdef_buf, "YY_INT_ALIGNED",
 		       long_align ? "long int" : "short int");
@@ -617,6 +835,7 @@ void flexend (exit_status)
                 "yy_new_buffer",
                 "yy_scan_buffer",
                 "yy_scan_bytes",
+                "yy_scan_const_bytes",
                 "yy_scan_string",
                 "yy_set_bol",
                 "yy_set_interactive",
@@ -636,11 +855,15 @@ void flexend (exit_status)
                 "yyget_lloc",
                 "yyget_lval",
                 "yyget_out",
+                "yyget_profile",
                 "yyget_text",
                 "yyin",
                 "yyleng",
                 "yyless",
                 "yylex",
+                "yylex_batch",
+                "yylex_parallel",
+                "yylex_push",
                 "yylex_destroy",
                 "yylex_init",
                 "yylex_init_extra",
@@ -649,6 +872,7 @@ void flexend (exit_status)
                 "yylval",
                 "yymore",
                 "yyout",
+                "yyprofile_dump",
                 "yyrealloc",
                 "yyrestart",
                 "yyset_debug",
@@ -696,6 +920,20 @@ void flexend (exit_status)
 		fclose (header_out);
 #endif
 
+	if (tables_source_out) {
+		if (ferror (tables_source_out))
+			lerrsf (_("error writing tables file %s"),
+				tables_source_name);
+
+		else if (fclose (tables_source_out))
+			lerrsf (_("error closing tables file %s"),
+				tables_source_name);
+
+		else if (exit_status != 0 && unlink (tables_source_name))
+			lerrsf (_("error deleting tables file %s"),
+				tables_source_name);
+	}
+
 	if (exit_status != 0 && outfile_created) {
 		if (ferror (stdout))
 			lerrsf (_("error writing output file %s"),
@@ -710,6 +948,14 @@ void flexend (exit_status)
 				outfilename);
 	}
 
+	/* Without --external-m4 there's no filter chain; the output is
+	 * expanded here.
+	 */
+	if (exit_status == 0 && !external_m4) {
+		phase_mark (PHASE_M4);
+		filter_expand (preproc_level);
+	}
+
 
 	if (backing_up_report && backing_up_file) {
 		if (num_backing_up == 0)
@@ -797,12 +1043,16 @@ void flexend (exit_status)
 			putc ('f', stderr);
 		if (fullspd)
 			putc ('F', stderr);
+		if (directcode)
+			putc ('g', stderr);
 		if (useecs)
 			putc ('e', stderr);
 		if (usemecs)
 			putc ('m', stderr);
 		if (use_read)
 			putc ('r', stderr);
+		if (packtbl)
+			putc ('x', stderr);
 
 		if (did_outfilename)
 			fprintf (stderr, " -o%s", outfilename);
@@ -817,8 +1067,18 @@ void flexend (exit_status)
 
 		fprintf (stderr, _("  %d/%d NFA states\n"),
 			 lastnfa, current_mns);
-		fprintf (stderr, _("  %d/%d DFA states (%d words)\n"),
-			 lastdfa, current_max_dfas, totnst);
+		if (lazy_dfa)
+			fprintf (stderr,
+				 _("  DFA states built by the scanner\n"));
+		else
+			fprintf (stderr, _("  %d/%d DFA states (%d words)\n"),
+				 lastdfa, current_max_dfas, totnst);
+
+		if (nummerged > 0)
+			fprintf (stderr,
+				 _("  %d equivalent DFA states merged\n"),
+				 nummerged);
+
 		fprintf (stderr, _("  %d rules\n"),
 			 num_rules + num_eof_rules -
 			 1 /* - 1 for def. rule */ );
@@ -891,6 +1151,13 @@ void flexend (exit_status)
 			fprintf (stderr,
 				 _("  %d templates created, %d uses\n"),
 				 numtemps, tmpuses);
+
+			if (num_full_rows > 0) {
+				tblsiz = tblsiz + (num_full_rows + 1) * (numecs + 1);
+				fprintf (stderr,
+					 _("  %d states with full rows\n"),
+					 num_full_rows);
+			}
 		}
 
 		if (useecs) {
@@ -923,6 +1190,131 @@ void flexend (exit_status)
 }
 
 
+/* phase_mark - end the current phase and start the next
+ *
+ * PHASE_SETUP starts a new run; NUM_PHASES ends the last phase.  A phase's
+ * peak memory is the process's high-water mark when it ends, except that
+ * with --external-m4, PHASE_M4's is that of the largest filter process.
+ */
+
+void phase_mark (phase)
+     int phase;
+{
+	double  now = phase_clock ();
+	int     i;
+
+	if (phase == PHASE_SETUP) {
+		for (i = 0; i < NUM_PHASES; ++i) {
+			phase_secs[i] = 0.0;
+			phase_maxrss[i] = 0;
+		}
+		cur_phase = -1;
+	}
+
+	if (cur_phase >= 0) {
+		phase_secs[cur_phase] += now - phase_started;
+		phase_maxrss[cur_phase] =
+			phase_rss (cur_phase == PHASE_M4 && external_m4);
+	}
+
+	cur_phase = phase < NUM_PHASES ? phase : -1;
+	phase_started = now;
+}
+
+
+/* phase_clock - wall clock time in seconds */
+
+static double phase_clock ()
+{
+#ifdef HAVE_GETTIMEOFDAY
+	struct timeval tv;
+
+	if (gettimeofday (&tv, (void *) 0) == 0)
+		return (double) tv.tv_sec + (double) tv.tv_usec / 1e6;
+#endif
+	return 0.0;
+}
+
+
+/* phase_rss - peak resident set size, of flex itself or of its children */
+
+static long phase_rss (children)
+     int children;
+{
+#ifdef HAVE_GETRUSAGE
+	struct rusage ru;
+
+	if (getrusage (children ? RUSAGE_CHILDREN : RUSAGE_SELF, &ru) == 0)
+		return ru.ru_maxrss;
+#endif
+	return 0;
+}
+
+
+/* child_cpu - CPU seconds used by the filter chain's processes */
+
+static double child_cpu ()
+{
+#ifdef HAVE_GETRUSAGE
+	struct rusage ru;
+
+	if (getrusage (RUSAGE_CHILDREN, &ru) == 0)
+		return (double) ru.ru_utime.tv_sec +
+			(double) ru.ru_utime.tv_usec / 1e6 +
+			(double) ru.ru_stime.tv_sec +
+			(double) ru.ru_stime.tv_usec / 1e6;
+#endif
+	return 0.0;
+}
+
+
+/* stats_report - write the --stats=json report to stderr
+ *
+ * Unlike -v, this is meant for scripts: one JSON object with the wall time
+ * and peak memory of each phase and the sizes of what the phases built.
+ */
+
+static void stats_report ()
+{
+	double  total = 0.0;
+	int     i;
+
+	fprintf (stderr, "{\n  \"flex_version\": \"%s\",\n", flex_version);
+	fprintf (stderr, "  \"phases\": [\n");
+
+	for (i = 0; i < NUM_PHASES; ++i) {
+		fprintf (stderr,
+			 "    {\"name\": \"%s\", \"seconds\": %.6f, \"maxrss_kb\": %ld",
+			 phase_names[i], phase_secs[i], phase_maxrss[i]);
+
+		if (i == PHASE_M4 && external_m4)
+			fprintf (stderr, ", \"cpu_seconds\": %.6f",
+				 child_cpu ());
+
+		fprintf (stderr, "}%s\n", i < NUM_PHASES - 1 ? "," : "");
+		total += phase_secs[i];
+	}
+
+	fprintf (stderr, "  ],\n  \"total_seconds\": %.6f,\n", total);
+	fprintf (stderr, "  \"counts\": {\n");
+	fprintf (stderr, "    \"rules\": %d,\n",
+		 num_rules + num_eof_rules - 1 /* - 1 for def. rule */ );
+	fprintf (stderr, "    \"nfa_states\": %d,\n", lastnfa);
+	fprintf (stderr, "    \"dfa_states\": %d,\n", lazy_dfa ? 0 : lastdfa);
+	fprintf (stderr, "    \"dfa_states_merged\": %d,\n", nummerged);
+	fprintf (stderr, "    \"state_nextstate_pairs\": %d,\n", numsnpairs);
+	fprintf (stderr, "    \"equivalence_classes\": %d,\n", numecs);
+	fprintf (stderr, "    \"meta_equivalence_classes\": %d,\n",
+		 usemecs ? nummecs : 0);
+	fprintf (stderr, "    \"templates\": %d,\n", numtemps);
+	fprintf (stderr, "    \"protos\": %d,\n", numprots);
+	fprintf (stderr, "    \"tblend\": %d,\n", tblend);
+	fprintf (stderr, "    \"peak_nxt_chk\": %d,\n", peakpairs);
+	fprintf (stderr, "    \"full_rows\": %d\n", num_full_rows);
+	fprintf (stderr, "  }\n}\n");
+}
+
+
 /* flexinit - initialize flex */
 
 void flexinit (argc, argv)
@@ -933,23 +1325,28 @@ void flexinit (argc, argv)
 	char   *arg;
 	scanopt_t sopt;
 
-	printstats = syntaxerror = trace = spprdflt = false;
+	printstats = stats_json = syntaxerror = trace = spprdflt = false;
+	external_m4 = false;
 	lex_compat = posix_compat = C_plus_plus = backing_up_report =
 		ddebug = fulltbl = false;
-	fullspd = long_align = nowarn = yymore_used = continued_action =
-		false;
+	fullspd = directcode = packtbl = long_align = nowarn =
+		yymore_used = continued_action = false;
 	do_yylineno = yytext_is_array = in_rule = reject = do_stdinit =
 		false;
 	yymore_really_used = reject_really_used = unspecified;
 	interactive = csize = unspecified;
-	do_yywrap = gen_line_dirs = usemecs = useecs = true;
+	do_yywrap = gen_line_dirs = usemecs = useecs = minimize = true;
 	reentrant = bison_bridge_lval = bison_bridge_lloc = false;
 	performance_report = 0;
 	did_outfilename = 0;
 	prefix = "yy";
 	yyclass = 0;
-	use_read = use_stdout = false;
-	tablesext = tablesverify = false;
+	use_read = use_stdout = zero_copy = read_ahead = token_batch =
+		push_scanner = parallel_scan = skip_loops = lazy_dfa = utf8 =
+		profile_counters = false;
+	tablesext = tablesverify = tables_native = false;
+	dfa_threads = 1;
+	hybrid_size = 0;
 	gentables = true;
 	tablesfilename = tablesname = NULL;
     ansi_func_defs = ansi_func_protos = true;
@@ -1028,6 +1425,7 @@ void flexinit (argc, argv)
 				useecs = false;
 				usemecs = false;
 				fulltbl = false;
+				directcode = false;
 				sawcmpflag = true;
 			}
 
@@ -1049,6 +1447,10 @@ void flexinit (argc, argv)
 					fulltbl = true;
 					break;
 
+				case 'g':
+					directcode = true;
+					break;
+
 				case 'm':
 					usemecs = true;
 					break;
@@ -1057,6 +1459,10 @@ void flexinit (argc, argv)
 					use_read = true;
 					break;
 
+				case 'x':
+					packtbl = true;
+					break;
+
 				default:
 					lerrif (_
 						("unknown -C option '%c'"),
@@ -1179,6 +1585,18 @@ void flexinit (argc, argv)
 			tablesverify = true;
 			break;
 
+		case OPT_TABLES_NATIVE:
+			tables_native = true;
+			break;
+
+		case OPT_TABLES_SOURCE:
+			tables_source_name = arg;
+			break;
+
+		case OPT_TABLES_BUNDLE:
+			tables_bundle_name = arg;
+			break;
+
 		case OPT_TRACE:
 			trace = true;
 			break;
@@ -1187,6 +1605,15 @@ void flexinit (argc, argv)
 			printstats = true;
 			break;
 
+		case OPT_STATS:
+			if (!strcmp (arg, "text"))
+				printstats = true;
+			else if (!strcmp (arg, "json"))
+				stats_json = true;
+			else
+				lerrsf (_("unknown --stats format %s"), arg);
+			break;
+
 		case OPT_VERSION:
 			printf (_("%s %s\n"), program_name, flex_version);
 			FLEX_EXIT (0);
@@ -1223,6 +1650,74 @@ void flexinit (argc, argv)
             buf_m4_define( &m4defs_buf, "M4_YY_NEVER_INTERACTIVE", 0);
 			break;
 
+		case OPT_MMAP:
+			buf_m4_define (&m4defs_buf, "M4_YY_MMAP", 0);
+			break;
+
+		case OPT_ZERO_COPY:
+			zero_copy = true;
+			break;
+
+		case OPT_READAHEAD:
+			read_ahead = true;
+			break;
+
+		case OPT_TOKEN_BATCH:
+			token_batch = true;
+			break;
+
+		case OPT_PUSH:
+			push_scanner = true;
+			break;
+
+		case OPT_PARALLEL:
+			parallel_scan = true;
+			break;
+
+		case OPT_SKIP_LOOPS:
+			skip_loops = true;
+			break;
+
+		case OPT_LAZY_DFA:
+			lazy_dfa = true;
+			break;
+
+		case OPT_UTF8:
+			utf8 = true;
+			break;
+
+		case OPT_PROFILE:
+			profile_counters = true;
+			break;
+
+		case OPT_PROFILE_GEN:
+			profile_gen_file = arg;
+			break;
+
+		case OPT_PROFILE_USE:
+			profile_use_file = arg;
+			break;
+
+		case OPT_DFA_THREADS:
+			dfa_threads = atoi (arg);
+
+			if (dfa_threads < 1)
+				flexerror (_
+					   ("--dfa-threads needs a positive number"));
+			break;
+
+		case OPT_EXTERNAL_M4:
+			external_m4 = true;
+			break;
+
+		case OPT_HYBRID:
+			hybrid_size = atoi (arg);
+
+			if (hybrid_size < 1)
+				flexerror (_
+					   ("--hybrid needs a positive size"));
+			break;
+
 		case OPT_ARRAY:
 			yytext_is_array = true;
 			break;
@@ -1247,10 +1742,22 @@ void flexinit (argc, argv)
 			usemecs = true;
 			break;
 
+		case OPT_MINIMIZE:
+			minimize = true;
+			break;
+
+		case OPT_NO_MINIMIZE:
+			minimize = false;
+			break;
+
 		case OPT_NO_META_ECS:
 			usemecs = false;
 			break;
 
+		case OPT_PACK:
+			packtbl = true;
+			break;
+
 		case OPT_PREPROCDEFINE:
 			{
 				/* arg is "symbol" or "symbol=definition". */
@@ -1429,6 +1936,16 @@ void flexinit (argc, argv)
 
 	num_input_files = argc - optind;
 	input_files = argv + optind;
+
+	/* Bundling tables files doesn't generate a scanner. */
+	if (tables_bundle_name) {
+		if (num_input_files == 0)
+			flexerror (_("--tables-bundle needs tables files to bundle"));
+		yytbl_bundle (tables_bundle_name, flex_version, input_files,
+			      num_input_files);
+		FLEX_EXIT (0);
+	}
+
 	set_input_file (num_input_files > 0 ? input_files[0] : NULL);
 
 	lastccl = lastsc = lastdfa = lastnfa = 0;
@@ -1436,7 +1953,8 @@ void flexinit (argc, argv)
 	numas = numsnpairs = tmpuses = 0;
 	numecs = numeps = eps2 = num_reallocs = hshcol = dfaeql = totnst =
 		0;
-	numuniq = numdup = hshsave = eofseen = datapos = dataline = 0;
+	numuniq = numdup = hshsave = nummerged = eofseen = datapos =
+		dataline = 0;
 	num_backing_up = onesp = numprots = 0;
 	variable_trailing_context_rules = bol_needed = false;
 
@@ -1462,11 +1980,15 @@ void readin ()
 
 	line_directive_out ((FILE *) 0, 1);
 
+	phase_mark (PHASE_PARSE);
+
 	if (yyparse ()) {
 		pinpoint_message (_("fatal parse error"));
 		flexend (1);
 	}
 
+	phase_mark (PHASE_ECS);
+
 	if (syntaxerror)
 		flexend (1);
 
@@ -1569,6 +2091,26 @@ void readin ()
 				   ("variable trailing context rules cannot be used with -f or -F"));
 	}
 
+	/* Skip loops don't leave the state stack REJECT needs behind them. */
+	if (skip_loops && reject) {
+		if (real_reject)
+			flexerror (_
+				   ("REJECT cannot be used with --skip-loops"));
+		else
+			flexerror (_
+				   ("variable trailing context rules cannot be used with --skip-loops"));
+	}
+
+	/* The DFA built at run time only knows which rule each state accepts. */
+	if (lazy_dfa && reject) {
+		if (real_reject)
+			flexerror (_
+				   ("REJECT cannot be used with --lazy-dfa"));
+		else
+			flexerror (_
+				   ("variable trailing context rules cannot be used with --lazy-dfa"));
+	}
+
 	if (reject){
         out_m4_define( "M4_YY_USES_REJECT", NULL);
 		//outn ("\n#define YY_USES_REJECT");
@@ -1710,7 +2252,8 @@ void readin ()
 
 void set_up_initial_allocations ()
 {
-	maximum_mns = (long_align ? MAXIMUM_MNS_LONG : MAXIMUM_MNS);
+	maximum_mns = (long_align ||
+		       lazy_dfa ? MAXIMUM_MNS_LONG : MAXIMUM_MNS);
 	current_mns = INITIAL_MNS;
 	firstst = allocate_integer_array (current_mns);
 	lastst = allocate_integer_array (current_mns);
@@ -1740,6 +2283,13 @@ void set_up_initial_allocations ()
 	ccllen = allocate_integer_array (current_maxccls);
 	cclng = allocate_integer_array (current_maxccls);
 	ccl_has_nl = allocate_bool_array (current_maxccls);
+	cclrng = allocate_integer_array (current_maxccls);
+
+	current_max_rngs = INITIAL_MAX_RNGS;
+	rngfirst = allocate_integer_array (current_max_rngs);
+	rnglast = allocate_integer_array (current_max_rngs);
+	rngnext = allocate_integer_array (current_max_rngs);
+	lastrng = 0;
 
 	current_max_ccl_tbl_size = INITIAL_MAX_CCL_TBL_SIZE;
 	ccltbl = allocate_Character_array (current_max_ccl_tbl_size);
@@ -1763,6 +2313,8 @@ void set_up_initial_allocations ()
 	dfaacc = allocate_dfaacc_union (current_max_dfas);
 
 	nultrans = (int *) 0;
+	skipmode = skipset = lazystart = (int *) 0;
+	num_full_rows = 0;
 }
 
 
@@ -1805,11 +2357,18 @@ void usage ()
 		  "  -Ce, --ecs        construct equivalence classes\n"
 		  "  -Cf               do not compress tables; use -f representation\n"
 		  "  -CF               do not compress tables; use -F representation\n"
+		  "  -Cg               match with generated code instead of walking tables\n"
 		  "  -Cm, --meta-ecs   construct meta-equivalence classes\n"
 		  "  -Cr, --read       use read() instead of stdio for scanner input\n"
+		  "  -Cx, --pack       pack the compressed tables more tightly, at some\n"
+		  "                    cost in generation time\n"
 		  "  -f, --full        generate fast, large scanner. Same as -Cfr\n"
 		  "  -F, --fast        use alternate table representation. Same as -CFr\n"
 		  "  -Cem              default compression (same as --ecs --meta-ecs)\n"
+		  "      --nominimize  don't merge equivalent DFA states\n"
+		  "      --hybrid=SIZE\n"
+		  "                    give the busiest states full rows as well, in up\n"
+		  "                    to SIZE bytes of extra table\n"
 		  "\n" "Debugging:\n"
 		  "  -d, --debug             enable debug mode in scanner\n"
 		  "  -b, --backup            write backing-up information to %s\n"
@@ -1818,13 +2377,21 @@ void usage ()
 		  "  -T, --trace             %s should run in trace mode\n"
 		  "  -w, --nowarn            do not generate warnings\n"
 		  "  -v, --verbose           write summary of scanner statistics to stdout\n"
+		  "      --stats=FORMAT      write statistics as text (same as -v) or as json,\n"
+		  "                          with the time and memory each phase took\n"
 		  "\n" "Files:\n"
 		  "  -o, --outfile=FILE      specify output filename\n"
 		  "  -S, --skel=FILE         specify skeleton file\n"
 		  "  -t, --stdout            write scanner on stdout instead of %s\n"
 		  "      --yyclass=NAME      name of C++ class\n"
 		  "      --header-file=FILE   create a C header file in addition to the scanner\n"
-		  "      --tables-file[=FILE] write tables to FILE\n" "\n"
+		  "      --tables-file[=FILE] write tables to FILE\n"
+		  "      --tables-native     write them in this machine's layout, to be mapped\n"
+		  "                          into memory and used in place\n"
+		  "      --tables-source=FILE write the tables' C definitions to FILE, to\n"
+		  "                          compile on their own\n"
+		  "      --tables-bundle=FILE bundle the tables files given as arguments into\n"
+		  "                          FILE, with an index of their table sets\n" "\n"
 		  "Scanner behavior:\n"
 		  "  -7, --7bit              generate 7-bit scanner\n"
 		  "  -8, --8bit              generate 8-bit scanner\n"
@@ -1833,9 +2400,28 @@ void usage ()
 		  "  -l, --lex-compat        maximal compatibility with original lex\n"
 		  "  -X, --posix-compat      maximal compatibility with POSIX lex\n"
 		  "  -I, --interactive       generate interactive scanner (opposite of -B)\n"
+		  "      --lazy-dfa          build the DFA while scanning, as the input\n"
+		  "                          needs it\n"
+		  "      --mmap              map regular input files into memory\n"
+		  "      --profile           count matches per rule, backing up and refills,\n"
+		  "                          for yyget_profile()\n"
+		  "      --profile-gen=FILE  have the scanner count its DFA state visits\n"
+		  "                          into FILE\n"
+		  "      --profile-use=FILE  put the DFA states most visited in FILE first\n"
+		  "      --push              take input from yylex_push() instead of YY_INPUT\n"
+		  "      --readahead         read input on a helper thread (needs -lpthread)\n"
+		  "      --skip-loops        skip through runs of input that leave the DFA\n"
+		  "                          in the same state\n"
+		  "      --utf8              patterns are UTF-8 and match UTF-8 characters\n"
 		  "      --yylineno          track line count in yylineno\n"
+		  "      --zero-copy         never write into the input buffer; yytext is\n"
+		  "                          not NUL-terminated\n"
 		  "\n" "Generated code:\n"
 		  "  -+,  --c++               generate C++ scanner class\n"
+		  "      --token-batch        also generate yylex_batch(), which returns an\n"
+		  "                           array of tokens per call\n"
+		  "      --parallel           also generate yylex_parallel(), which scans a\n"
+		  "                           buffer on several threads (needs -lpthread)\n"
 		  "  -Dmacro[=defn]           #define macro defn  (default defn is '1')\n"
 		  "  -L,  --noline            suppress #line directives in scanner\n"
 		  "  -P,  --prefix=STRING     use STRING as prefix instead of \"yy\"\n"
@@ -1850,6 +2436,9 @@ void usage ()
 		  "\n" "Miscellaneous:\n"
 		  "  -c                      do-nothing POSIX option\n"
 		  "  -n                      do-nothing POSIX option\n"
+		  "      --dfa-threads=N     build the DFA on N threads\n"
+		  "      --external-m4       expand the scanner with the m4 program rather\n"
+		  "                          than within flex\n"
 		  "  -?\n"
 		  "  -h, --help              produce this help message\n"
 		  "  -V, --version           report %s version\n"),
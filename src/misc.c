@@ -308,6 +308,97 @@ int cclcmp (const void *a, const void *b)
 }
 
 
+/* Table data is formatted into data_buf rather than printed an item at a
+ * time; what's there is written out before anything else is.  It, and the
+ * out() family, go to OUT_FILE: the scanner, or the --tables-source file
+ * while a table begun by table_begin() is written there.
+ */
+
+static FILE *table_file = NULL;
+
+#define OUT_FILE (table_file ? table_file : stdout)
+
+#define DATA_BUF_SIZE 16384
+
+static char data_buf[DATA_BUF_SIZE];
+static int data_len = 0;
+
+static const char digit_pairs[] =
+	"0001020304050607080910111213141516171819"
+	"2021222324252627282930313233343536373839"
+	"4041424344454647484950515253545556575859"
+	"6061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
+#define DATA_DRAIN() do { if (data_len > 0) data_drain (); } while (0)
+#define DATA_PUTC(c) do { \
+		if (data_len == DATA_BUF_SIZE) \
+			data_drain (); \
+		data_buf[data_len++] = (c); \
+	} while (0)
+
+static void data_drain PROTO ((void));
+static void data_puts PROTO ((const char *));
+static void data_dec PROTO ((int, int));
+
+
+/* data_drain - write out the table data formatted so far */
+
+static void data_drain ()
+{
+	fwrite (data_buf, 1, data_len, OUT_FILE);
+	data_len = 0;
+}
+
+
+/* data_puts - add a string to the table data */
+
+static void data_puts (str)
+     const char *str;
+{
+	while (*str)
+		DATA_PUTC (*str++);
+}
+
+
+/* data_dec - add a number to the table data, as printf's "%*d" would */
+
+static void data_dec (value, width)
+     int value, width;
+{
+	char    digits[16], *p = digits + sizeof (digits);
+	unsigned int u = value < 0 ? -(unsigned int) value : (unsigned int) value;
+	int     n;
+
+	while (u >= 100) {
+		n = (u % 100) * 2;
+		u /= 100;
+		*--p = digit_pairs[n + 1];
+		*--p = digit_pairs[n];
+	}
+
+	if (u >= 10) {
+		*--p = digit_pairs[u * 2 + 1];
+		*--p = digit_pairs[u * 2];
+	}
+	else
+		*--p = '0' + u;
+
+	if (value < 0)
+		*--p = '-';
+
+	n = digits + sizeof (digits) - p;
+
+	if (data_len + MAX (n, width) > DATA_BUF_SIZE)
+		data_drain ();
+
+	for (; width > n; --width)
+		data_buf[data_len++] = ' ';
+	memcpy (data_buf + data_len, p, n);
+	data_len += n;
+}
+
+
 /* dataend - finish up a block of data declarations */
 
 void dataend ()
@@ -320,6 +411,7 @@ void dataend ()
 
 		/* add terminator for initialization; { for vi */
 		outn ("    } ;\n");
+		table_end ();
 	}
 	dataline = 0;
 	datapos = 0;
@@ -334,13 +426,13 @@ void dataflush ()
 	if (!gentables)
 		return;
 
-	outc ('\n');
+	DATA_PUTC ('\n');
 
 	if (++dataline >= NUMDATALINES) {
 		/* Put out a blank line so that the table is grouped into
 		 * large blocks that enable the user to find elements easily.
 		 */
-		outc ('\n');
+		DATA_PUTC ('\n');
 		dataline = 0;
 	}
 
@@ -463,6 +555,8 @@ void line_directive_out (output_file, do_infile)
 	 * the accumulated actions.
 	 */
 	if (output_file) {
+		if (output_file == stdout)
+			DATA_DRAIN ();
 		fputs (directive, output_file);
 	}
 	else
@@ -506,20 +600,20 @@ void mk2data (value)
 		return;
 
 	if (datapos >= NUMDATAITEMS) {
-		outc (',');
+		DATA_PUTC (',');
 		dataflush ();
 	}
 
 	if (datapos == 0)
 		/* Indent. */
-		out ("    ");
+		data_puts ("    ");
 
 	else
-		outc (',');
+		DATA_PUTC (',');
 
 	++datapos;
 
-	out_dec ("%5d", value);
+	data_dec (value, 5);
 }
 
 
@@ -536,19 +630,19 @@ void mkdata (value)
 		return;
 
 	if (datapos >= NUMDATAITEMS) {
-		outc (',');
+		DATA_PUTC (',');
 		dataflush ();
 	}
 
 	if (datapos == 0)
 		/* Indent. */
-		out ("    ");
+		data_puts ("    ");
 	else
-		outc (',');
+		DATA_PUTC (',');
 
 	++datapos;
 
-	out_dec ("%5d", value);
+	data_dec (value, 5);
 }
 
 
@@ -666,66 +760,76 @@ int otoi (str)
 
 
 /* out - various flavors of outputing a (possibly formatted) string for the
- *	 generated scanner, keeping track of the line count.
+ *	 generated scanner, keeping track of the line count.  Any table data
+ *	 still in data_buf goes out first.
  */
 
 void out (str)
      const char *str;
 {
-	fputs (str, stdout);
+	DATA_DRAIN ();
+	fputs (str, OUT_FILE);
 }
 
 void out_dec (fmt, n)
      const char *fmt;
      int n;
 {
-	fprintf (stdout, fmt, n);
+	DATA_DRAIN ();
+	fprintf (OUT_FILE, fmt, n);
 }
 
 void out_dec2 (fmt, n1, n2)
      const char *fmt;
      int n1, n2;
 {
-	fprintf (stdout, fmt, n1, n2);
+	DATA_DRAIN ();
+	fprintf (OUT_FILE, fmt, n1, n2);
 }
 
 void out_hex (fmt, x)
      const char *fmt;
      unsigned int x;
 {
-	fprintf (stdout, fmt, x);
+	DATA_DRAIN ();
+	fprintf (OUT_FILE, fmt, x);
 }
 
 void out_str (fmt, str)
      const char *fmt, str[];
 {
-	fprintf (stdout,fmt, str);
+	DATA_DRAIN ();
+	fprintf (OUT_FILE, fmt, str);
 }
 
 void out_str3 (fmt, s1, s2, s3)
      const char *fmt, s1[], s2[], s3[];
 {
-	fprintf (stdout,fmt, s1, s2, s3);
+	DATA_DRAIN ();
+	fprintf (OUT_FILE, fmt, s1, s2, s3);
 }
 
 void out_str_dec (fmt, str, n)
      const char *fmt, str[];
      int n;
 {
-	fprintf (stdout,fmt, str, n);
+	DATA_DRAIN ();
+	fprintf (OUT_FILE, fmt, str, n);
 }
 
 void outc (c)
      int c;
 {
-	fputc (c, stdout);
+	DATA_DRAIN ();
+	fputc (c, OUT_FILE);
 }
 
 void outn (str)
      const char *str;
 {
-	fputs (str,stdout);
-    fputc('\n',stdout);
+	DATA_DRAIN ();
+	fputs (str, OUT_FILE);
+	fputc ('\n', OUT_FILE);
 }
 
 /** Print "m4_define( [[def]], [[val]])m4_dnl\n".
@@ -736,6 +840,8 @@ void outn (str)
 void out_m4_define (const char* def, const char* val)
 {
     const char * fmt = "m4_define( [[%s]], [[%s]])m4_dnl\n";
+
+    DATA_DRAIN ();
     fprintf(stdout, fmt, def, val?val:"");
 }
 
@@ -937,6 +1043,62 @@ void skelout ()
 }
 
 
+/* table_begin - begin the definition of a table
+ *
+ * The table is an array of n elements of the given type or, if row_len is
+ * nonzero, of rows of row_len elements.  The caller writes the initializer
+ * and finishes with dataend() or table_end().  With --tables-source the
+ * definition goes to that file, under a name carrying the prefix, and the
+ * scanner only gets a declaration of it.
+ */
+
+void table_begin (type, name, n, row_len)
+     const char *type, *name;
+     int n, row_len;
+{
+	char    decl[MAXLINE];
+
+	if (row_len > 0)
+		snprintf (decl, sizeof (decl), "yyconst %s %s[][%d]", type,
+			  name, row_len);
+	else
+		snprintf (decl, sizeof (decl), "yyconst %s %s[%d]", type,
+			  name, n);
+
+	DATA_DRAIN ();
+
+	if (!tables_source_out) {
+		fprintf (stdout, "static %s =\n", decl);
+		return;
+	}
+
+	/* Tables are named yy_*; the prefix stands in for the "yy". */
+	if (strcmp (prefix, "yy")) {
+		fprintf (stdout, "#define %s %s%s\n", name, prefix, name + 2);
+		fprintf (tables_source_out, "#define %s %s%s\n", name,
+			 prefix, name + 2);
+	}
+
+	fprintf (stdout, "extern %s;\n", decl);
+
+	/* The declaration gives the definition external linkage in C++. */
+	fprintf (tables_source_out, "extern %s;\n%s =\n", decl, decl);
+
+	table_file = tables_source_out;
+}
+
+
+/* table_end - finish a table begun by table_begin() */
+
+void table_end ()
+{
+	if (table_file) {
+		DATA_DRAIN ();
+		table_file = NULL;
+	}
+}
+
+
 /* transition_struct_out - output a yy_trans_info structure
  *
  * outputs the yy_trans_info structure with the two elements, element_v and
@@ -951,15 +1113,19 @@ void transition_struct_out (element_v, element_n)
 	if (!gentables)
 		return;
 
-	out_dec2 (" {%4d,%4d },", element_v, element_n);
+	data_puts (" {");
+	data_dec (element_v, 4);
+	DATA_PUTC (',');
+	data_dec (element_n, 4);
+	data_puts (" },");
 
 	datapos += TRANS_STRUCT_PRINT_LENGTH;
 
 	if (datapos >= 79 - TRANS_STRUCT_PRINT_LENGTH) {
-		outc ('\n');
+		DATA_PUTC ('\n');
 
 		if (++dataline % 10 == 0)
-			outc ('\n');
+			DATA_PUTC ('\n');
 
 		datapos = 0;
 	}
@@ -254,7 +254,7 @@ void    finish_rule (mach, variable_trail_rule, headcnt, trailcnt,
 			char   *scanner_bp = "yy_bp";
 
 			add_action
-				("*yy_cp = YY_G(yy_hold_char); /* undo effects of setting up yytext */\n");
+				("YY_RESTORE_HOLD_CHAR /* undo effects of setting up yytext */\n");
 
 			if (headcnt > 0) {
 				if (rule_has_nl[num_rules]) {
@@ -667,6 +667,261 @@ current_mns);
 }
 
 
+/* The UTF-8 encodings of a range of code points, split into pieces that
+ * are each a run of byte ranges: every byte string with its i'th byte in
+ * lo[i]..hi[i] encodes a code point in the piece, and only those do.
+ */
+
+struct utf8_seq {
+	int     len;
+	int     lo[4], hi[4];
+};
+
+static struct utf8_seq *utf8_seqs;
+static int utf8_nseqs, utf8_max_seqs;
+
+/* The byte ccls made so far for mkbyterange(), by first and last byte. */
+static int *utf8_byteccls;
+
+
+/* utf8_encode - write the UTF-8 encoding of c into buf, returning its length */
+
+static int utf8_encode (c, buf)
+     int     c;
+     int     buf[];
+{
+	int     len = UTF8_LEN (c);
+	int     i;
+
+	for (i = len - 1; i > 0; --i) {
+		buf[i] = 0x80 | (c & 0x3f);
+		c >>= 6;
+	}
+
+	buf[0] = len == 1 ? c : ((0xff00 >> len) & 0xff) | c;
+	return len;
+}
+
+
+/* utf8_split - add the pieces encoding lo through hi to utf8_seqs
+ *
+ * lo and hi are cut at each change of encoding length, and then wherever
+ * their trailing bytes don't span all of 0x80-0xbf, until each part is a
+ * plain run of byte ranges.  The pieces come out in code point order,
+ * which is also the byte order of their encodings.
+ */
+
+static void utf8_split (lo, hi)
+     int     lo, hi;
+{
+	static const int len_max[] = { 0x7f, 0x7ff, 0xffff };
+	struct utf8_seq *seq;
+	int     i, m, bl[4], bh[4];
+
+	if (lo > hi)
+		return;
+
+	for (i = 0; i < 3; ++i)
+		if (lo <= len_max[i] && len_max[i] < hi) {
+			utf8_split (lo, len_max[i]);
+			utf8_split (len_max[i] + 1, hi);
+			return;
+		}
+
+	for (i = 1; i < 4; ++i) {
+		m = (1 << (6 * i)) - 1;
+
+		if ((lo & ~m) != (hi & ~m)) {
+			if ((lo & m) != 0) {
+				utf8_split (lo, lo | m);
+				utf8_split ((lo | m) + 1, hi);
+				return;
+			}
+
+			if ((hi & m) != m) {
+				utf8_split (lo, (hi & ~m) - 1);
+				utf8_split (hi & ~m, hi);
+				return;
+			}
+		}
+	}
+
+	if (utf8_nseqs >= utf8_max_seqs) {
+		utf8_max_seqs += 100;
+		utf8_seqs = (struct utf8_seq *)
+			reallocate_array ((void *) utf8_seqs, utf8_max_seqs,
+					  sizeof (struct utf8_seq));
+	}
+
+	seq = &utf8_seqs[utf8_nseqs++];
+	seq->len = utf8_encode (lo, bl);
+	utf8_encode (hi, bh);
+
+	for (i = 0; i < seq->len; ++i) {
+		seq->lo[i] = bl[i];
+		seq->hi[i] = bh[i];
+	}
+}
+
+
+/* mkbyterange - make a machine matching one byte in lo through hi
+ *
+ * The bytes here are all above 0x7f.  Ranges of them repeat a lot, so
+ * each gets a single ccl, made the first time it's needed.
+ */
+
+static int mkbyterange (lo, hi)
+     int     lo, hi;
+{
+	int     i, cclp;
+
+	if (lo == hi)
+		return mkstate (lo);
+
+	if (!utf8_byteccls) {
+		utf8_byteccls = allocate_integer_array (128 * 128);
+		for (i = 0; i < 128 * 128; ++i)
+			utf8_byteccls[i] = 0;
+	}
+
+	cclp = utf8_byteccls[(lo - 0x80) * 128 + hi - 0x80];
+
+	if (!cclp) {
+		cclp = cclinit ();
+		for (i = lo; i <= hi; ++i)
+			ccladd (cclp, i);
+
+		if (useecs)
+			mkeccl (ccltbl + cclmap[cclp], ccllen[cclp],
+				nextecm, ecgroup, csize, csize);
+
+		utf8_byteccls[(lo - 0x80) * 128 + hi - 0x80] = cclp;
+	}
+
+	return mkstate (-cclp);
+}
+
+
+/* mkutf8seqs - make a machine matching pieces first through last - 1
+ *
+ * The pieces all have the same bytes ranges before position depth.
+ * Runs of pieces that also share the range at depth share its state.
+ */
+
+static int mkutf8seqs (first, last, depth)
+     int     first, last, depth;
+{
+	struct utf8_seq *seq;
+	int     mach = NIL, i, j;
+
+	for (i = first; i < last; i = j) {
+		seq = &utf8_seqs[i];
+
+		for (j = i + 1; j < last; ++j)
+			if (utf8_seqs[j].len != seq->len ||
+			    utf8_seqs[j].lo[depth] != seq->lo[depth] ||
+			    utf8_seqs[j].hi[depth] != seq->hi[depth])
+				break;
+
+		if (depth + 1 < seq->len)
+			mach = mkor (mach,
+				     link_machines (mkbyterange
+						    (seq->lo[depth],
+						     seq->hi[depth]),
+						    mkutf8seqs (i, j,
+								depth + 1)));
+		else
+			mach = mkor (mach, mkbyterange (seq->lo[depth],
+							seq->hi[depth]));
+	}
+
+	return mach;
+}
+
+
+/* mkutf8char - make a machine matching the UTF-8 encoding of code point c */
+
+int     mkutf8char (c)
+     int     c;
+{
+	int     buf[4], len, i, mach = NIL;
+
+	len = utf8_encode (c, buf);
+
+	for (i = 0; i < len; ++i)
+		mach = link_machines (mach, mkstate (buf[i]));
+
+	return mach;
+}
+
+
+/* mkutf8ccl - make a machine matching any code point in a ccl, in UTF-8
+ *
+ * synopsis
+ *
+ *   mach = mkutf8ccl( cclp, &len );
+ *
+ *     mach - a machine matching the UTF-8 bytes of any member of cclp
+ *     len  - set to how many bytes mach matches, or 0 if that varies
+ *
+ * The ASCII members go in one byte ccl, as they always have; the rest
+ * become a tree of byte ranges, with a branch for each distinct prefix.
+ */
+
+int     mkutf8ccl (cclp, len_addr)
+     int     cclp, *len_addr;
+{
+	int    *ranges;
+	int     nranges, i, first, asciiccl, mach;
+
+	nranges = ccl_ranges (cclp, &ranges);
+
+	utf8_nseqs = 0;
+	for (i = 0; i < nranges; ++i)
+		utf8_split (ranges[2 * i], ranges[2 * i + 1]);
+
+	flex_free ((void *) ranges);
+
+	*len_addr = utf8_nseqs > 0 ? utf8_seqs[0].len : 1;
+	for (i = 1; i < utf8_nseqs; ++i)
+		if (utf8_seqs[i].len != *len_addr)
+			*len_addr = 0;
+
+	/* The one-byte pieces come first, since they're lowest. */
+	for (first = 0; first < utf8_nseqs; ++first)
+		if (utf8_seqs[first].len > 1)
+			break;
+
+	if (first > 0 || utf8_nseqs == 0) {
+		asciiccl = cclinit ();
+		for (i = 0; i < first; ++i) {
+			int     c;
+
+			for (c = utf8_seqs[i].lo[0]; c <= utf8_seqs[i].hi[0];
+			     ++c)
+				ccladd (asciiccl, c);
+		}
+
+		/* Sorted with NUL last, as symfollowset() expects. */
+		qsort (ccltbl + cclmap[asciiccl], (size_t) ccllen[asciiccl],
+		       sizeof (*ccltbl), cclcmp);
+
+		if (useecs)
+			mkeccl (ccltbl + cclmap[asciiccl], ccllen[asciiccl],
+				nextecm, ecgroup, csize, csize);
+
+		mach = mkstate (-asciiccl);
+	}
+	else
+		mach = NIL;
+
+	if (first < utf8_nseqs)
+		mach = mkor (mach, mkutf8seqs (first, utf8_nseqs, 0));
+
+	return mach;
+}
+
+
 /* mkxtion - make a transition from one state to another
  *
  * synopsis
@@ -143,6 +143,18 @@ optspec_t flexopts[] = {
 	,			/* Construct meta-equivalence classes. */
 	{"--nometa-ecs", OPT_NO_META_ECS, 0}
 	,
+	{"--pack", OPT_PACK, 0}
+	,			/* Pack the compressed tables more tightly. */
+	{"--minimize", OPT_MINIMIZE, 0}
+	,			/* Merge equivalent DFA states. */
+	{"--nominimize", OPT_NO_MINIMIZE, 0}
+	,
+	{"--mmap", OPT_MMAP, 0}
+	,			/* Map regular input files into memory. */
+	{"--push", OPT_PUSH, 0}
+	,			/* Take input from yylex_push(). */
+	{"--readahead", OPT_READAHEAD, 0}
+	,			/* Read input on a helper thread. */
 	{"--never-interactive", OPT_NEVER_INTERACTIVE, 0}
 	,
 	{"-o FILE", OPT_OUTFILE, 0}
@@ -195,12 +207,42 @@ optspec_t flexopts[] = {
 	,			/* Save tables to FILE */
         {"--tables-verify", OPT_TABLES_VERIFY, 0}
         ,                       /* Tables integrity check */
+	{"--tables-native", OPT_TABLES_NATIVE, 0}
+	,			/* Write the tables in the native layout. */
+	{"--tables-source=FILE", OPT_TABLES_SOURCE, 0}
+	,			/* Write the tables to the C file FILE. */
+	{"--tables-bundle=FILE", OPT_TABLES_BUNDLE, 0}
+	,			/* Bundle tables files, with an index. */
+	{"--token-batch", OPT_TOKEN_BATCH, 0}
+	,			/* Also generate yylex_batch(). */
+	{"--parallel", OPT_PARALLEL, 0}
+	,			/* Also generate yylex_parallel(). */
+	{"--skip-loops", OPT_SKIP_LOOPS, 0}
+	,			/* Skip through runs of input that stay in one state. */
+	{"--lazy-dfa", OPT_LAZY_DFA, 0}
+	,			/* Build the DFA while scanning. */
+	{"--dfa-threads=N", OPT_DFA_THREADS, 0}
+	,			/* Build the DFA on N threads. */
+	{"--external-m4", OPT_EXTERNAL_M4, 0}
+	,			/* Expand the output with the m4 program. */
+	{"--utf8", OPT_UTF8, 0}
+	,			/* Patterns match UTF-8 characters. */
+	{"--profile", OPT_PROFILE, 0}
+	,			/* Count rule matches, backing up and refills. */
+	{"--profile-gen=FILE", OPT_PROFILE_GEN, 0}
+	,			/* Count DFA state visits into FILE. */
+	{"--profile-use=FILE", OPT_PROFILE_USE, 0}
+	,			/* Order DFA states by the counts in FILE. */
+	{"--hybrid=SIZE", OPT_HYBRID, 0}
+	,			/* Give the busiest states full rows, up to SIZE bytes. */
 	{"--nounistd", OPT_NO_UNISTD_H, 0}
 	,			/* Do not include unistd.h */
 	{"-v", OPT_VERBOSE, 0}
 	,
 	{"--verbose", OPT_VERBOSE, 0}
 	,			/* Write summary of scanner statistics to stdout. */
+	{"--stats=FORMAT", OPT_STATS, 0}
+	,			/* Write statistics as text or as json. */
 	{"-V", OPT_VERSION, 0}
 	,
 	{"--version", OPT_VERSION, 0}
@@ -230,6 +272,8 @@ optspec_t flexopts[] = {
 	,
 	{"--yywrap", OPT_YYWRAP, 0}
 	,
+	{"--zero-copy", OPT_ZERO_COPY, 0}
+	,			/* Never write into the input buffer. */
 
 	{"--nounput", OPT_NO_UNPUT, 0}
 	,
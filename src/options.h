@@ -56,6 +56,7 @@ enum flexopt_flag_t {
 	OPT_DEFAULT,
 	OPT_DONOTHING,
 	OPT_ECS,
+	OPT_EXTERNAL_M4,
 	OPT_FAST,
 	OPT_FULL,
 	OPT_HEADER_FILE,
@@ -65,6 +66,10 @@ enum flexopt_flag_t {
 	OPT_POSIX_COMPAT,
 	OPT_MAIN,
 	OPT_META_ECS,
+	OPT_MMAP,
+	OPT_ZERO_COPY,
+	OPT_READAHEAD,
+	OPT_PUSH,
 	OPT_NEVER_INTERACTIVE,
 	OPT_NO_ALIGN,
         OPT_NO_ANSI_FUNC_DEFS,
@@ -75,6 +80,8 @@ enum flexopt_flag_t {
 	OPT_NO_LINE,
 	OPT_NO_MAIN,
 	OPT_NO_META_ECS,
+	OPT_NO_MINIMIZE,
+	OPT_PACK,
 	OPT_NO_REENTRANT,
 	OPT_NO_REJECT,
 	OPT_NO_STDINIT,
@@ -118,9 +125,24 @@ enum flexopt_flag_t {
 	OPT_STDOUT,
 	OPT_TABLES_FILE,
 	OPT_TABLES_VERIFY,
+	OPT_TABLES_SOURCE,
+	OPT_TABLES_NATIVE,
+	OPT_TABLES_BUNDLE,
+	OPT_TOKEN_BATCH,
+	OPT_PARALLEL,
+	OPT_SKIP_LOOPS,
+	OPT_LAZY_DFA,
+	OPT_MINIMIZE,
+	OPT_DFA_THREADS,
+	OPT_UTF8,
+	OPT_PROFILE,
+	OPT_PROFILE_GEN,
+	OPT_PROFILE_USE,
+	OPT_HYBRID,
 	OPT_TRACE,
 	OPT_NO_UNISTD_H,
 	OPT_VERBOSE,
+	OPT_STATS,
 	OPT_VERSION,
 	OPT_WARN,
 	OPT_YYCLASS,
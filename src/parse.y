@@ -10,6 +10,8 @@
 %token CCE_NEG_ALNUM CCE_NEG_ALPHA CCE_NEG_BLANK CCE_NEG_CNTRL CCE_NEG_DIGIT CCE_NEG_GRAPH
 %token CCE_NEG_LOWER CCE_NEG_PRINT CCE_NEG_PUNCT CCE_NEG_SPACE CCE_NEG_UPPER CCE_NEG_XDIGIT
 
+%token CCE_UNIPROP
+
 %left CCL_OP_DIFF CCL_OP_UNION
 
 /*
@@ -92,13 +94,15 @@ int previous_continued_action;	/* whether the previous rule's action was '|' */
 			ccladd( currccl, c ); \
 	}while(0)
 
-/* negated class */
+/* negated class; with --utf8, all of the non-ASCII code points */
 #define CCL_NEG_EXPR(func) \
 	do{ \
 	int c; \
-	for ( c = 0; c < csize; ++c ) \
+	for ( c = 0; c < (utf8 ? 0x80 : csize); ++c ) \
 		if ( !func(c) ) \
 			ccladd( currccl, c ); \
+	if ( utf8 ) \
+		ccladd_range( currccl, 0x80, UTF8_MAX ); \
 	}while(0)
 
 /* While POSIX defines isblank(), it's not ANSI C. */
@@ -713,40 +717,65 @@ singleton	:  singleton '*'
 				madeany = true;
 				}
 
-			++rulelen;
+			if ( utf8 )
+				$$ = mkutf8singl( sf_dot_all() ? cclany : ccldot );
 
-            if (sf_dot_all())
-                $$ = mkstate( -cclany );
-            else
-                $$ = mkstate( -ccldot );
+			else
+				{
+				++rulelen;
+
+				if (sf_dot_all())
+					$$ = mkstate( -cclany );
+				else
+					$$ = mkstate( -ccldot );
+				}
 			}
 
 		|  fullccl
 			{
+			if ( utf8 )
+				$$ = mkutf8singl( $1 );
+
+			else
+				{
 				/* Sort characters for fast searching.
 				 */
 				qsort( ccltbl + cclmap[$1], ccllen[$1], sizeof (*ccltbl), cclcmp );
 
-			if ( useecs )
-				mkeccl( ccltbl + cclmap[$1], ccllen[$1],
-					nextecm, ecgroup, csize, csize );
+				if ( useecs )
+					mkeccl( ccltbl + cclmap[$1], ccllen[$1],
+						nextecm, ecgroup, csize, csize );
 
-			++rulelen;
+				++rulelen;
 
-			if (ccl_has_nl[$1])
-				rule_has_nl[num_rules] = true;
+				if (ccl_has_nl[$1])
+					rule_has_nl[num_rules] = true;
 
-			$$ = mkstate( -$1 );
+				$$ = mkstate( -$1 );
+				}
 			}
 
 		|  PREVCCL
 			{
-			++rulelen;
+			if ( utf8 )
+				$$ = mkutf8singl( $1 );
 
-			if (ccl_has_nl[$1])
-				rule_has_nl[num_rules] = true;
+			else
+				{
+				++rulelen;
+
+				if (ccl_has_nl[$1])
+					rule_has_nl[num_rules] = true;
+
+				$$ = mkstate( -$1 );
+				}
+			}
 
-			$$ = mkstate( -$1 );
+		|  CCE_UNIPROP
+			{
+			currccl = cclinit();
+			ccl_add_uniprop( currccl, $1 );
+			$$ = mkutf8singl( currccl );
 			}
 
 		|  '"' string '"'
@@ -757,16 +786,25 @@ singleton	:  singleton '*'
 
 		|  CHAR
 			{
-			++rulelen;
+			if ( utf8 && $1 >= 0x80 )
+				{
+				rulelen += UTF8_LEN( $1 );
+				$$ = mkutf8char( $1 );
+				}
 
-			if ($1 == nlch)
-				rule_has_nl[num_rules] = true;
+			else
+				{
+				++rulelen;
 
-            if (sf_case_ins() && has_case($1))
-                /* create an alternation, as in (a|A) */
-                $$ = mkor (mkstate($1), mkstate(reverse_case($1)));
-            else
-                $$ = mkstate( $1 );
+				if ($1 == nlch)
+					rule_has_nl[num_rules] = true;
+
+				if (sf_case_ins() && has_case($1))
+					/* create an alternation, as in (a|A) */
+					$$ = mkor (mkstate($1), mkstate(reverse_case($1)));
+				else
+					$$ = mkstate( $1 );
+				}
 			}
 		;
 fullccl:
@@ -820,8 +858,7 @@ ccl		:  ccl CHAR '-' CHAR
 
 			else
 				{
-				for ( i = $2; i <= $4; ++i )
-					ccladd( $1, i );
+				ccladd_range( $1, $2, $4 );
 
 				/* Keep track if this ccl is staying in
 				 * alphabetical order.
@@ -848,7 +885,7 @@ ccl		:  ccl CHAR '-' CHAR
 
 		|  ccl CHAR
 			{
-			ccladd( $1, $2 );
+			ccladd_range( $1, $2, $2 );
 			cclsorted = cclsorted && ($2 > lastchar);
 			lastchar = $2;
 
@@ -923,6 +960,8 @@ ccl_expr:
 				else
 					CCL_NEG_EXPR(isupper);
 				}
+
+		|  CCE_UNIPROP	{ ccl_add_uniprop( currccl, $1 ); }
 		;
 		
 string		:  string CHAR
@@ -932,7 +971,13 @@ string		:  string CHAR
 
 			++rulelen;
 
-            if (sf_case_ins() && has_case($2))
+			if ( utf8 && $2 >= 0x80 )
+				{
+				rulelen += UTF8_LEN( $2 ) - 1;
+				$$ = mkutf8char( $2 );
+				}
+
+            else if (sf_case_ins() && has_case($2))
                 $$ = mkor (mkstate($2), mkstate(reverse_case($2)));
             else
                 $$ = mkstate ($2);
@@ -947,6 +992,28 @@ string		:  string CHAR
 %%
 
 
+/* mkutf8singl - make the singleton for a ccl of code points, with --utf8 */
+
+int mkutf8singl( cclp )
+int cclp;
+	{
+	int len, mach;
+
+	if ( ccl_has_nl[cclp] )
+		rule_has_nl[num_rules] = true;
+
+	mach = mkutf8ccl( cclp, &len );
+
+	/* The ccl may hold characters of different lengths. */
+	if ( len )
+		rulelen += len;
+	else
+		varlength = true;
+
+	return mach;
+	}
+
+
 /* build_eof_action - build the "<<EOF>>" action for the active start
  *                    conditions
  */
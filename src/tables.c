@@ -57,6 +57,8 @@ int     yytbl_write16 (struct yytbl_writer *wr, flex_uint16_t v);
 int     yytbl_write8 (struct yytbl_writer *wr, flex_uint8_t v);
 int     yytbl_writen (struct yytbl_writer *wr, void *v, flex_int32_t len);
 static flex_int32_t yytbl_data_geti (const struct yytbl_data *tbl, int i);
+static int yytbl_write_native (struct yytbl_writer *wr, flex_int32_t v,
+			       int size);
 /* XXX Not used
 static flex_int32_t yytbl_data_getijk (const struct yytbl_data *tbl, int i,
 				  int j, int k);
@@ -72,9 +74,53 @@ int yytbl_writer_init (struct yytbl_writer *wr, FILE * out)
 {
 	wr->out = out;
 	wr->total_written = 0;
+	wr->native = 0;
 	return 0;
 }
 
+/** The names of the table identifiers, for the scanner's yydmap. */
+static const char *yytbl_id_names[YYTD_ID_ACCLIST + 1] = {
+	0,
+	"YYTD_ID_ACCEPT",
+	"YYTD_ID_BASE",
+	"YYTD_ID_CHK",
+	"YYTD_ID_DEF",
+	"YYTD_ID_EC",
+	"YYTD_ID_META",
+	"YYTD_ID_NUL_TRANS",
+	"YYTD_ID_NXT",
+	"YYTD_ID_RULE_CAN_MATCH_EOL",
+	"YYTD_ID_START_STATE_LIST",
+	"YYTD_ID_TRANSITION",
+	"YYTD_ID_ACCLIST"
+};
+
+/** The size of each element of a table in the scanner, by table id; what
+ *  the native layout writes.
+ */
+static int yytbl_native_size[YYTD_ID_ACCLIST + 1];
+
+/** Add a table to the scanner's yydmap.
+ *  @param id the table identifier
+ *  @param name the name of the table in the scanner
+ *  @param type the type of its elements there
+ */
+void yytbl_dmap_add (enum yytbl_id id, const char *name, const char *type)
+{
+	char    line[MAXLINE];
+
+	snprintf (line, sizeof (line),
+		  "\t{%s, (void**)&%s, sizeof(%s)},\n",
+		  yytbl_id_names[id], name, type);
+	buf_strappend (&yydmap_buf, line);
+
+	/* Tables of pointers into yy_transition are written as int32
+	 * indices, and are expanded as they're loaded.
+	 */
+	yytbl_native_size[id] = strcmp (type, "flex_int16_t") ?
+		sizeof (flex_int32_t) : sizeof (flex_int16_t);
+}
+
 /** Initialize a table header.
  *  @param th  The uninitialized structure
  *  @param version_str the  version string
@@ -191,14 +237,26 @@ int yytbl_data_fwrite (struct yytbl_writer *wr, struct yytbl_data *td)
 {
 	int  rv;
 	flex_int32_t bwritten = 0;
-	flex_int32_t i, total_len;
+	flex_int32_t i, total_len, hsize = 12;
+	flex_uint16_t flags = td->td_flags;
+	int     size;
 	fpos_t  pos;
 
+	/* In the native layout the data is as wide as the scanner's. */
+	if (wr->native) {
+		size = yytbl_native_size[td->td_id];
+		if (size == 0)
+			size = sizeof (flex_int32_t);
+		flags = TFLAGS_CLRDATA (flags) | BYTES2TFLAG (size);
+	}
+	else
+		size = YYTDFLAGS2BYTES (flags);
+
 	if ((rv = yytbl_write16 (wr, td->td_id)) < 0)
 		return -1;
 	bwritten += rv;
 
-	if ((rv = yytbl_write16 (wr, td->td_flags)) < 0)
+	if ((rv = yytbl_write16 (wr, flags)) < 0)
 		return -1;
 	bwritten += rv;
 
@@ -210,21 +268,33 @@ int yytbl_data_fwrite (struct yytbl_writer *wr, struct yytbl_data *td)
 		return -1;
 	bwritten += rv;
 
+	/* Start native data on a 64-bit boundary, so it can be used in place. */
+	if (wr->native) {
+		if ((rv = yytbl_write32 (wr, 0)) < 0)
+			return -1;
+		bwritten += rv;
+		hsize += rv;
+	}
+
 	total_len = yytbl_calc_total_len (td);
 	for (i = 0; i < total_len; i++) {
-		switch (YYTDFLAGS2BYTES (td->td_flags)) {
-		case sizeof (flex_int8_t):
-			rv = yytbl_write8 (wr, yytbl_data_geti (td, i));
-			break;
-		case sizeof (flex_int16_t):
-			rv = yytbl_write16 (wr, yytbl_data_geti (td, i));
-			break;
-		case sizeof (flex_int32_t):
-			rv = yytbl_write32 (wr, yytbl_data_geti (td, i));
-			break;
-		default:
-			flex_die (_("invalid td_flags detected"));
-		}
+		if (wr->native)
+			rv = yytbl_write_native (wr, yytbl_data_geti (td, i),
+						 size);
+		else
+			switch (size) {
+			case sizeof (flex_int8_t):
+				rv = yytbl_write8 (wr, yytbl_data_geti (td, i));
+				break;
+			case sizeof (flex_int16_t):
+				rv = yytbl_write16 (wr, yytbl_data_geti (td, i));
+				break;
+			case sizeof (flex_int32_t):
+				rv = yytbl_write32 (wr, yytbl_data_geti (td, i));
+				break;
+			default:
+				flex_die (_("invalid td_flags detected"));
+			}
 		if (rv < 0) {
 			flex_die (_("error while writing tables"));
 			return -1;
@@ -233,7 +303,7 @@ int yytbl_data_fwrite (struct yytbl_writer *wr, struct yytbl_data *td)
 	}
 
 	/* Sanity check */
-	if (bwritten != (int) (12 + total_len * YYTDFLAGS2BYTES (td->td_flags))) {
+	if (bwritten != (int) (hsize + total_len * size)) {
 		flex_die (_("insanity detected"));
 		return -1;
 	}
@@ -314,6 +384,22 @@ int yytbl_write16 (struct yytbl_writer *wr, flex_uint16_t v)
 	return bytes;
 }
 
+/** Write an int16 or int32 in host byte order, for the native layout.
+ *  @param  wr  the table writer
+ *  @param  v    the value to be written
+ *  @param  size  its size in bytes
+ *  @return  -1 on error. number of bytes written on success.
+ */
+static int yytbl_write_native (struct yytbl_writer *wr, flex_int32_t v,
+			       int size)
+{
+	flex_int16_t v16 = (flex_int16_t) v;
+
+	if (size == sizeof (flex_int16_t))
+		return yytbl_writen (wr, &v16, size);
+	return yytbl_writen (wr, &v, size);
+}
+
 /** Write a byte.
  *  @param  wr  the table writer
  *  @param  v    the value to be written
@@ -499,4 +585,196 @@ void yytbl_data_compress (struct yytbl_data *tbl)
 	*tbl = newtbl;
 }
 
+/** A table set being gathered into a bundle. */
+struct yytbl_bundle_set {
+	const char *data;	/**< the whole set, header included */
+	flex_uint32_t size;	/**< its th_ssize */
+	const char *name;	/**< its th_name, within data */
+	int     seq;		/**< its position among the inputs */
+};
+
+/** Get a uint32 in network byte order from a buffer. */
+static flex_uint32_t yytbl_get32 (const char *p)
+{
+	const unsigned char *u = (const unsigned char *) p;
+
+	return ((flex_uint32_t) u[0] << 24) | ((flex_uint32_t) u[1] << 16)
+		| ((flex_uint32_t) u[2] << 8) | (flex_uint32_t) u[3];
+}
+
+/** Order the sets of a bundle by name, and by position within a name. */
+static int yytbl_bundle_cmp (const void *a, const void *b)
+{
+	const struct yytbl_bundle_set *x = a, *y = b;
+	int     c = strcmp (x->name, y->name);
+
+	return c ? c : x->seq - y->seq;
+}
+
+/** Read a whole file into memory.
+ *  @param filename the file
+ *  @param len set to the number of bytes read
+ *  @return the contents, to be freed by the caller
+ */
+static char *yytbl_read_file (const char *filename, size_t *len)
+{
+	FILE   *fp;
+	char   *buf = NULL;
+	size_t  size = 0, n;
+
+	if ((fp = fopen (filename, "rb")) == NULL)
+		lerrsf (_("can't open %s"), filename);
+
+	*len = 0;
+	do {
+		if (*len == size) {
+			size = size ? size * 2 : 65536;
+			if ((buf = realloc (buf, size)) == NULL)
+				flexfatal (_("memory allocation failed in yytbl_read_file()"));
+		}
+		n = fread (buf + *len, 1, size - *len, fp);
+		*len += n;
+	} while (n > 0);
+
+	if (ferror (fp))
+		lerrsf (_("error reading %s"), filename);
+	fclose (fp);
+	return buf;
+}
+
+/** Write a bundle: an index of the table sets in the given tables files,
+ *  followed by the sets themselves, so that a scanner can seek straight to
+ *  its own set instead of reading past all those before it.  Where several
+ *  sets have the same name, only the first is kept.
+ *  @param outname the name of the bundle
+ *  @param version_str the version string for the index's header
+ *  @param files the tables files, which may themselves be bundles
+ *  @param nfiles the number of files
+ *  @return 0 on success
+ */
+int yytbl_bundle (const char *outname, const char *version_str,
+		  char **files, int nfiles)
+{
+	struct yytbl_bundle_set *sets = NULL;
+	struct yytbl_writer wr;
+	struct yytbl_hdr th;
+	char  **bufs;
+	int     nsets = 0, maxsets = 0, i, j;
+	flex_uint32_t body, off;
+	FILE   *out;
+
+	if ((bufs = calloc (nfiles + 1, sizeof (char *))) == NULL)
+		flexfatal (_("memory allocation failed in yytbl_bundle()"));
+
+	for (i = 0; i < nfiles; i++) {
+		size_t  len, pos;
+		const char *data;
+
+		data = bufs[i] = yytbl_read_file (files[i], &len);
+
+		for (pos = 0; pos < len;) {
+			flex_uint32_t hsize, ssize;
+			const char *version, *name;
+
+			if (len - pos < 16
+			    || yytbl_get32 (data + pos) != YYTBL_MAGIC)
+				lerrsf (_("%s is not a tables file"), files[i]);
+
+			hsize = yytbl_get32 (data + pos + 4);
+			ssize = yytbl_get32 (data + pos + 8);
+			version = data + pos + 14;
+			name = NULL;
+			if (hsize >= 16 && hsize <= ssize && ssize <= len - pos
+			    && ssize % 8 == 0
+			    && (name = memchr (version, 0, hsize - 14)) != NULL) {
+				name++;
+				if (!memchr (name, 0, data + pos + hsize - name))
+					name = NULL;
+			}
+			if (!name)
+				lerrsf (_("%s has a damaged table set"), files[i]);
+
+			/* An index is rebuilt rather than copied. */
+			if (!(data[pos + 13] & YYTH_INDEX)) {
+				if (nsets == maxsets) {
+					maxsets = maxsets ? maxsets * 2 : 64;
+					sets = realloc (sets, maxsets * sizeof (*sets));
+					if (!sets)
+						flexfatal (_("memory allocation failed in yytbl_bundle()"));
+				}
+				sets[nsets].data = data + pos;
+				sets[nsets].size = ssize;
+				sets[nsets].name = name;
+				sets[nsets].seq = nsets;
+				nsets++;
+			}
+			pos += ssize;
+		}
+	}
+
+	/* Sort by name, then drop all but the first of each name. */
+	qsort (sets, nsets, sizeof (*sets), yytbl_bundle_cmp);
+	for (i = j = 0; i < nsets; i++)
+		if (j > 0 && !strcmp (sets[i].name, sets[j - 1].name))
+			format_warn (_("table set %s appears more than once; the first is kept"),
+				     sets[i].name);
+		else
+			sets[j++] = sets[i];
+	nsets = j;
+
+	/* The index's body: the count, the entries, and the names. */
+	body = 4 + nsets * 8;
+	for (i = 0; i < nsets; i++)
+		body += strlen (sets[i].name) + 1;
+
+	yytbl_hdr_init (&th, version_str, "");
+	th.th_flags = YYTH_INDEX;
+	th.th_ssize = th.th_hsize + body + yypad64 (body);
+
+	if ((out = fopen (outname, "wb")) == NULL)
+		lerrsf (_("could not create %s"), outname);
+	yytbl_writer_init (&wr, out);
+	yytbl_hdr_fwrite (&wr, &th);
+
+	if (yytbl_write32 (&wr, nsets) < 0)
+		flex_die (_("error while writing tables"));
+
+	off = th.th_ssize;
+	body = 4 + nsets * 8;
+	for (i = 0; i < nsets; i++) {
+		if (yytbl_write32 (&wr, off) < 0
+		    || yytbl_write32 (&wr, body) < 0)
+			flex_die (_("error while writing tables"));
+		if (off + sets[i].size < off)
+			lerrsf (_("%s would be too large"), outname);
+		off += sets[i].size;
+		body += strlen (sets[i].name) + 1;
+	}
+
+	for (i = 0; i < nsets; i++) {
+		int     sz = strlen (sets[i].name) + 1;
+
+		if (yytbl_writen (&wr, (void *) sets[i].name, sz) != sz)
+			flex_die (_("error while writing tables"));
+	}
+	if (yytbl_write_pad64 (&wr) < 0)
+		flex_die (_("pad64 failed"));
+
+	for (i = 0; i < nsets; i++)
+		if (yytbl_writen (&wr, (void *) sets[i].data, sets[i].size) !=
+		    (int) sets[i].size)
+			flex_die (_("error while writing tables"));
+
+	if (fclose (out) != 0)
+		lerrsf (_("error writing output file %s"), outname);
+
+	for (i = 0; i < nfiles; i++)
+		free (bufs[i]);
+	free (bufs);
+	free (sets);
+	free (th.th_version);
+	free (th.th_name);
+	return 0;
+}
+
 /* vim:set noexpandtab cindent tabstop=8 softtabstop=0 shiftwidth=8 textwidth=0: */
@@ -49,6 +49,8 @@ struct yytbl_writer {
 			    /**< bytes written so far */
 	fpos_t  th_ssize_pos;
 			    /**< position of th_ssize */
+	int     native;
+			    /**< write the data in the native layout */
 };
 
 /* These are used by main.c, gen.c, etc.
@@ -57,9 +59,10 @@ struct yytbl_writer {
  * tablesname - name that goes in serialized data, e.g., "yytables"
  * tableswr -  writer for external tables
  * tablesverify - true if tables-verify option specified
+ * tables_native - true if the tables are written in the native layout
  * gentables - true if we should spit out the normal C tables
  */
-extern bool tablesext, tablesverify,gentables;
+extern bool tablesext, tablesverify,gentables, tables_native;
 extern char *tablesfilename, *tablesname;
 extern struct yytbl_writer tableswr;
 
@@ -72,6 +75,10 @@ int     yytbl_hdr_fwrite (struct yytbl_writer *wr,
 			  const struct yytbl_hdr *th);
 int     yytbl_data_fwrite (struct yytbl_writer *wr, struct yytbl_data *td);
 void    yytbl_data_compress (struct yytbl_data *tbl);
+void    yytbl_dmap_add (enum yytbl_id id, const char *name,
+			const char *type);
+int     yytbl_bundle (const char *outname, const char *version_str,
+		      char **files, int nfiles);
 struct yytbl_data *mkftbl (void);
 
 
@@ -53,9 +53,11 @@ dnl  flex code (hence the name "_shared").
  *
  *  -  The format allows many tables per file.
  *  -  The tables can be streamed.
- *  -  All data is stored in network byte order.
+ *  -  All data is stored in network byte order, except in a native
+ *     (YYTH_NATIVE) set, which can be mapped into memory and used in place.
  *  -  We do not hinder future unicode support.
- *  -  We can lookup tables by name.
+ *  -  We can lookup tables by name, and a bundle's index (YYTH_INDEX)
+ *     finds a set by name without reading the sets before it.
  */
 
 /** Magic number for serialized format. */
@@ -89,6 +91,19 @@ enum yytbl_id {
 	YYTD_ID_ACCLIST = 0x0C		/**< 1-dim ints */
 };
 
+/** bit flags for th_flags field of struct yytbl_hdr */
+enum yytbl_hdr_flags {
+	YYTH_NATIVE = 0x01,     /**< format 2: the table data is in the scanner's
+                                 own layout and in the byte order of the
+                                 machine that wrote it, each table aligned
+                                 to 64 bits */
+	YYTH_BIG_ENDIAN = 0x02, /**< with YYTH_NATIVE, that byte order is
+                                 big-endian */
+	YYTH_INDEX = 0x04       /**< this set holds no tables, but the index
+                                 of the sets that follow it. See
+                                 struct yytbl_index_entry. */
+};
+
 /** bit flags for t_flags field of struct yytbl_data */
 enum yytbl_flags {
 	/* These first three are mutually exclusive */
@@ -108,11 +123,20 @@ struct yytbl_hdr {
 	flex_uint32_t th_magic;  /**< Must be 0xF13C57B1 (comes from "Flex Table") */
 	flex_uint32_t th_hsize;  /**< Size of this header in bytes. */
 	flex_uint32_t th_ssize;  /**< Size of this dataset, in bytes, including header. */
-	flex_uint16_t th_flags;  /**< Currently unused, must be 0 */
+	flex_uint16_t th_flags;  /**< enum yytbl_hdr_flags */
 	char   *th_version; /**< Flex version string. NUL terminated. */
 	char   *th_name;    /**< The name of this table set. NUL terminated. */
 };
 
+/** An entry in a bundle's index.  The index set's header is followed by
+ *  a uint32 count of entries, the entries, sorted by name, and then the
+ *  names, NUL terminated; all in network byte order.
+ */
+struct yytbl_index_entry {
+	flex_uint32_t ti_offset; /**< offset of the set from the start of the index set */
+	flex_uint32_t ti_name;   /**< offset of its name from the count */
+};
+
 /** A single serialized table */
 struct yytbl_data {
 	flex_uint16_t td_id;      /**< enum yytbl_id table identifier */
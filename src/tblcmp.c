@@ -41,6 +41,51 @@ void mkprot PROTO ((int[], int, int));
 void mktemplate PROTO ((int[], int, int));
 void mv2front PROTO ((int));
 int tbldiff PROTO ((int[], int, int[]));
+static void resize_busy PROTO ((void));
+static unsigned long busy_bits PROTO ((int));
+static int next_free PROTO ((int));
+static int first_fit PROTO ((int));
+static void defer_entry PROTO ((int *, int, int, int, int));
+static int entrycmp PROTO ((const void *, const void *));
+
+
+/* The nxt/chk slots in use, as a bitmap: bit i is set if chk[i] != 0.  The
+ * first-fit searches skip over runs of used slots a word at a time with it,
+ * and test all of a state's slots against a base a word at a time.  It's
+ * kept up to date by SET_CHK(), which is how this file writes chk[].
+ */
+#define BUSY_BITS ((int) (sizeof (unsigned long) * 8))
+#define BUSY_WORD(i) ((i) / BUSY_BITS)
+#define BUSY_BIT(i) (1UL << ((i) % BUSY_BITS))
+
+#define SET_CHK(pos, val) \
+	do { \
+		int set_pos = (pos); \
+		if ((chk[set_pos] = (val)) != 0) \
+			chk_busy[BUSY_WORD (set_pos)] |= BUSY_BIT (set_pos); \
+	} while (0)
+
+static unsigned long *chk_busy;
+static int num_busy_words;
+
+/* The slots first_fit() looks for, relative to the base it returns.  Bit 0
+ * is always set.
+ */
+static unsigned long fit_mask[(CSIZE + 2) / (sizeof (unsigned long) * 8) + 2];
+static int fit_words;
+
+/* With -Cx, mkentry() saves each state's entries here instead of placing
+ * them, and pack_entries() places them all once the templates are built.
+ * A state's entries are entry_ec[first] through entry_ec[first + num - 1]
+ * and the matching entry_nxt[]s.
+ */
+struct table_entry {
+	int     statenum, minec, maxec, first, num;
+};
+
+static struct table_entry *entries;
+static int num_entries, max_entries;
+static int *entry_ec, *entry_nxt, num_entry_slots, max_entry_slots;
 
 
 /* bldtbl - build table entries for dfa state
@@ -302,6 +347,115 @@ void    expand_nxt_chk ()
 
 	zero_out ((char *) (chk + old_max),
 		  (size_t) (MAX_XPAIRS_INCREMENT * sizeof (int)));
+
+	if (chk_busy)
+		resize_busy ();
+}
+
+
+/* resize_busy - make chk_busy cover all of chk */
+
+static void resize_busy ()
+{
+	int     num_words = BUSY_WORD (current_max_xpairs) + 1;
+	int     i;
+
+	if (num_words <= num_busy_words)
+		return;
+
+	if (chk_busy)
+		chk_busy = (unsigned long *)
+			reallocate_array ((void *) chk_busy, num_words,
+					  sizeof (unsigned long));
+	else
+		chk_busy = (unsigned long *)
+			allocate_array (num_words, sizeof (unsigned long));
+
+	for (i = num_busy_words; i < num_words; ++i)
+		chk_busy[i] = 0;
+
+	num_busy_words = num_words;
+}
+
+
+/* busy_bits - the BUSY_BITS bits of chk_busy starting at slot pos */
+
+static unsigned long busy_bits (pos)
+     int pos;
+{
+	int     word = BUSY_WORD (pos), shift = pos % BUSY_BITS;
+	unsigned long bits;
+
+	if (word >= num_busy_words)
+		return 0;
+
+	bits = chk_busy[word] >> shift;
+
+	if (shift && word + 1 < num_busy_words)
+		bits |= chk_busy[word + 1] << (BUSY_BITS - shift);
+
+	return bits;
+}
+
+
+/* next_free - the first unused slot in chk at or after pos
+ *
+ * Slots past the end of chk count as unused, since expand_nxt_chk() will
+ * zero them; the result may be >= current_max_xpairs.
+ */
+
+static int next_free (pos)
+     int pos;
+{
+	int     word = BUSY_WORD (pos), bit;
+	unsigned long unused;
+
+	if (word >= num_busy_words)
+		return pos;
+
+	unused = ~chk_busy[word] & (~0UL << (pos % BUSY_BITS));
+
+	while (!unused) {
+		if (++word >= num_busy_words)
+			return word * BUSY_BITS;
+
+		unused = ~chk_busy[word];
+	}
+
+#ifdef __GNUC__
+	bit = __builtin_ctzl (unused);
+#else
+	for (bit = 0; !(unused & 1); unused >>= 1)
+		++bit;
+#endif
+
+	return word * BUSY_BITS + bit;
+}
+
+
+/* first_fit - the first base at or after pos where fit_mask's slots are free
+ *
+ * Every base is tried in turn, as the old slot-by-slot scan did, so states
+ * are packed exactly as tightly as before; the bitmap just makes each try
+ * cheap.
+ */
+
+static int first_fit (pos)
+     int pos;
+{
+	int     i;
+
+	for (;; ++pos) {
+		/* Bit 0 is in fit_mask, so only free slots can be bases. */
+		pos = next_free (pos);
+
+		for (i = 0; i < fit_words; ++i)
+			if (busy_bits (pos + i * BUSY_BITS) & fit_mask[i])
+				break;
+
+		if (i == fit_words)
+			return pos;
+	}
 }
 
 
@@ -330,9 +484,7 @@ int     find_table_space (state, numtrans)
 	/* Firstfree is the position of the first possible occurrence of two
 	 * consecutive unused records in the chk and nxt arrays.
 	 */
-	register int i;
-	register int *state_ptr, *chk_ptr;
-	register int *ptr_to_last_entry_in_state;
+	register int i, start;
 
 	/* If there are too many out-transitions, put the state at the end of
 	 * nxt and chk.
@@ -347,7 +499,7 @@ int     find_table_space (state, numtrans)
 		/* Start searching for table space near the end of
 		 * chk/nxt arrays.
 		 */
-		i = tblend - numecs;
+		start = tblend - numecs;
 	}
 
 	else
@@ -355,62 +507,34 @@ int     find_table_space (state, numtrans)
 		 * (skipping only the elements which will definitely not
 		 * hold the new state).
 		 */
-		i = firstfree;
-
-	while (1) {		/* loops until a space is found */
-		while (i + numecs >= current_max_xpairs)
-			expand_nxt_chk ();
+		start = firstfree;
 
-		/* Loops until space for end-of-buffer and action number
-		 * are found.
-		 */
-		while (1) {
-			/* Check for action number space. */
-			if (chk[i - 1] == 0) {
-				/* Check for end-of-buffer space. */
-				if (chk[i] == 0)
-					break;
-
-				else
-					/* Since i != 0, there is no use
-					 * checking to see if (++i) - 1 == 0,
-					 * because that's the same as i == 0,
-					 * so we skip a space.
-					 */
-					i += 2;
-			}
-
-			else
-				++i;
+	/* The state needs the slots for its action number (i - 1) and
+	 * end-of-buffer (i), and one for each of its out-transitions.
+	 */
+	fit_words = BUSY_WORD (numecs + 1) + 1;
 
-			while (i + numecs >= current_max_xpairs)
-				expand_nxt_chk ();
-		}
+	for (i = 0; i < fit_words; ++i)
+		fit_mask[i] = 0;
 
-		/* If we started search from the beginning, store the new
-		 * firstfree for the next call of find_table_space().
-		 */
-		if (numtrans <= MAX_XTIONS_FULL_INTERIOR_FIT)
-			firstfree = i + 1;
+	fit_mask[0] = BUSY_BIT (0) | BUSY_BIT (1);
 
-		/* Check to see if all elements in chk (and therefore nxt)
-		 * that are needed for the new state have not yet been taken.
-		 */
+	for (i = 1; i <= numecs; ++i)
+		if (state[i] != 0)
+			fit_mask[BUSY_WORD (i + 1)] |= BUSY_BIT (i + 1);
 
-		state_ptr = &state[1];
-		ptr_to_last_entry_in_state = &chk[i + numecs + 1];
+	i = first_fit (start - 1) + 1;
 
-		for (chk_ptr = &chk[i + 1];
-		     chk_ptr != ptr_to_last_entry_in_state; ++chk_ptr)
-			if (*(state_ptr++) != 0 && *chk_ptr != 0)
-				break;
+	while (i + numecs >= current_max_xpairs)
+		expand_nxt_chk ();
 
-		if (chk_ptr == ptr_to_last_entry_in_state)
-			return i;
+	/* If we started search from the beginning, store the new
+	 * firstfree for the next call of find_table_space().
+	 */
+	if (numtrans <= MAX_XTIONS_FULL_INTERIOR_FIT)
+		firstfree = i + 1;
 
-		else
-			++i;
-	}
+	return i;
 }
 
 
@@ -427,6 +551,9 @@ void    inittbl ()
 
 		  (size_t) (current_max_xpairs * sizeof (int)));
 
+	num_busy_words = 0;
+	resize_busy ();
+
 	tblend = 0;
 	firstfree = tblend + 1;
 	numtemps = 0;
@@ -464,11 +591,11 @@ void    mkdeftbl ()
 
 	/* Add in default end-of-buffer transition. */
 	nxt[tblend] = end_of_buffer_state;
-	chk[tblend] = jamstate;
+	SET_CHK (tblend, jamstate);
 
 	for (i = 1; i <= numecs; ++i) {
 		nxt[tblend + i] = 0;
-		chk[tblend + i] = jamstate;
+		SET_CHK (tblend + i, jamstate);
 	}
 
 	jambase = tblend;
@@ -523,9 +650,10 @@ void    mkentry (state, numchars, statenum, deflink, totaltrans)
 				break;
 	}
 
-	if (totaltrans == 1) {
+	if (totaltrans == 1 && !packtbl) {
 		/* There's only one out-transition.  Save it for later to fill
-		 * in holes in the tables.
+		 * in holes in the tables.  (With -Cx, pack_entries() places
+		 * these last anyway.)
 		 */
 		stack1 (statenum, minec, state[minec], deflink);
 		return;
@@ -537,6 +665,12 @@ void    mkentry (state, numchars, statenum, deflink, totaltrans)
 				break;
 	}
 
+	if (packtbl) {
+		def[statenum] = deflink;
+		defer_entry (state, statenum, deflink, minec, maxec);
+		return;
+	}
+
 	/* Whether we try to fit the state table in the middle of the table
 	 * entries we have already generated, or if we just take the state
 	 * table at the end of the nxt/chk tables, we must make sure that we
@@ -549,36 +683,21 @@ void    mkentry (state, numchars, statenum, deflink, totaltrans)
 	/* Find the first transition of state that we need to worry about. */
 	if (totaltrans * 100 <= numchars * INTERIOR_FIT_PERCENTAGE) {
 		/* Attempt to squeeze it into the middle of the tables. */
-		baseaddr = firstfree;
+		fit_words = BUSY_WORD (maxec - minec) + 1;
 
-		while (baseaddr < minec) {
-			/* Using baseaddr would result in a negative base
-			 * address below; find the next free slot.
-			 */
-			for (++baseaddr; chk[baseaddr] != 0; ++baseaddr) ;
-		}
-
-		while (baseaddr + maxec - minec + 1 >= current_max_xpairs)
-			expand_nxt_chk ();
+		for (i = 0; i < fit_words; ++i)
+			fit_mask[i] = 0;
 
 		for (i = minec; i <= maxec; ++i)
 			if (state[i] != SAME_TRANS &&
-			    (state[i] != 0 || deflink != JAMSTATE) &&
-			    chk[baseaddr + i - minec] != 0) {	/* baseaddr unsuitable - find another */
-				for (++baseaddr;
-				     baseaddr < current_max_xpairs &&
-				     chk[baseaddr] != 0; ++baseaddr) ;
-
-				while (baseaddr + maxec - minec + 1 >=
-				       current_max_xpairs)
-						expand_nxt_chk ();
-
-				/* Reset the loop counter so we'll start all
-				 * over again next time it's incremented.
-				 */
+			    (state[i] != 0 || deflink != JAMSTATE))
+				fit_mask[BUSY_WORD (i - minec)] |=
+					BUSY_BIT (i - minec);
 
-				i = minec - 1;
-			}
+		/* Starting below minec would result in a negative base
+		 * address below.
+		 */
+		baseaddr = first_fit (MAX (firstfree, minec));
 	}
 
 	else {
@@ -601,17 +720,145 @@ void    mkentry (state, numchars, statenum, deflink, totaltrans)
 		if (state[i] != SAME_TRANS)
 			if (state[i] != 0 || deflink != JAMSTATE) {
 				nxt[tblbase + i] = state[i];
-				chk[tblbase + i] = statenum;
+				SET_CHK (tblbase + i, statenum);
 			}
 
 	if (baseaddr == firstfree)
 		/* Find next free slot in tables. */
-		for (++firstfree; chk[firstfree] != 0; ++firstfree) ;
+		firstfree = next_free (firstfree + 1);
 
 	tblend = MAX (tblend, tbllast);
 }
 
 
+/* defer_entry - save a state's entries for pack_entries() */
+
+static void defer_entry (state, statenum, deflink, minec, maxec)
+     int    *state, statenum, deflink, minec, maxec;
+{
+	struct table_entry *e;
+	int     i;
+
+	if (num_entries >= max_entries) {
+		max_entries = max_entries ? max_entries * 2 : 1024;
+		entries = (struct table_entry *)
+			reallocate_array ((void *) entries, max_entries,
+					  sizeof (struct table_entry));
+	}
+
+	while (num_entry_slots + maxec - minec + 1 > max_entry_slots) {
+		max_entry_slots =
+			max_entry_slots ? max_entry_slots * 2 : 16384;
+		entry_ec = reallocate_integer_array (entry_ec,
+						     max_entry_slots);
+		entry_nxt = reallocate_integer_array (entry_nxt,
+						      max_entry_slots);
+	}
+
+	e = &entries[num_entries++];
+	e->statenum = statenum;
+	e->minec = minec;
+	e->maxec = maxec;
+	e->first = num_entry_slots;
+
+	for (i = minec; i <= maxec; ++i)
+		if (state[i] != SAME_TRANS &&
+		    (state[i] != 0 || deflink != JAMSTATE)) {
+			entry_ec[num_entry_slots] = i;
+			entry_nxt[num_entry_slots++] = state[i];
+		}
+
+	e->num = num_entry_slots - e->first;
+}
+
+
+/* entrycmp - order saved entries densest first, for pack_entries()
+ *
+ * The states with the most entries are the hardest to fit, so they go in
+ * while the table is still empty; the sparse ones fill in the gaps they
+ * leave.  Ties go to the wider state, then to the lower state number.
+ */
+
+static int entrycmp (a, b)
+     const void *a, *b;
+{
+	const struct table_entry *e1 = &entries[*(const int *) a];
+	const struct table_entry *e2 = &entries[*(const int *) b];
+
+	if (e1->num != e2->num)
+		return e2->num - e1->num;
+
+	if (e1->maxec - e1->minec != e2->maxec - e2->minec)
+		return (e2->maxec - e2->minec) - (e1->maxec - e1->minec);
+
+	return e1->statenum - e2->statenum;
+}
+
+
+/* pack_entries - place the entries mkentry() saved with -Cx
+ *
+ * mkentry() places each state as it comes, at the first base that fits
+ * if it's sparse enough and at the end of the table if not.  Here every
+ * state is placed at the first base that fits, densest state first,
+ * which leaves far fewer holes in nxt/chk.
+ */
+
+void    pack_entries ()
+{
+	struct table_entry *e;
+	int    *order, baseaddr, tblbase, tbllast, i, j;
+
+	if (num_entries == 0)
+		return;
+
+	order = allocate_integer_array (num_entries);
+
+	for (i = 0; i < num_entries; ++i)
+		order[i] = i;
+
+	qsort (order, (size_t) num_entries, sizeof (int), entrycmp);
+
+	for (i = 0; i < num_entries; ++i) {
+		e = &entries[order[i]];
+
+		fit_words = BUSY_WORD (e->maxec - e->minec) + 1;
+
+		for (j = 0; j < fit_words; ++j)
+			fit_mask[j] = 0;
+
+		for (j = e->first; j < e->first + e->num; ++j)
+			fit_mask[BUSY_WORD (entry_ec[j] - e->minec)] |=
+				BUSY_BIT (entry_ec[j] - e->minec);
+
+		/* As in mkentry(), the base mustn't be negative. */
+		baseaddr = first_fit (MAX (firstfree, e->minec));
+		tblbase = baseaddr - e->minec;
+		tbllast = tblbase + e->maxec;
+
+		while (tbllast + 1 >= current_max_xpairs)
+			expand_nxt_chk ();
+
+		base[e->statenum] = tblbase;
+
+		for (j = e->first; j < e->first + e->num; ++j) {
+			nxt[tblbase + entry_ec[j]] = entry_nxt[j];
+			SET_CHK (tblbase + entry_ec[j], e->statenum);
+		}
+
+		firstfree = next_free (firstfree);
+		tblend = MAX (tblend, tbllast);
+	}
+
+	flex_free ((void *) order);
+	flex_free ((void *) entries);
+	flex_free ((void *) entry_ec);
+	flex_free ((void *) entry_nxt);
+	entries = 0;
+	entry_ec = entry_nxt = 0;
+	num_entries = max_entries = num_entry_slots = max_entry_slots = 0;
+}
+
+
 /* mk1tbl - create table entries for a state (or state fragment) which
  *            has only one out-transition
  */
@@ -622,13 +869,14 @@ void    mk1tbl (state, sym, onenxt, onedef)
 	if (firstfree < sym)
 		firstfree = sym;
 
-	while (chk[firstfree] != 0)
-		if (++firstfree >= current_max_xpairs)
-			expand_nxt_chk ();
+	firstfree = next_free (firstfree);
+
+	while (firstfree >= current_max_xpairs)
+		expand_nxt_chk ();
 
 	base[state] = firstfree - sym;
 	def[state] = onedef;
-	chk[firstfree] = state;
+	SET_CHK (firstfree, state);
 	nxt[firstfree] = onenxt;
 
 	if (firstfree > tblend) {
@@ -774,19 +1022,19 @@ void    place_state (state, statenum, transnum)
 	 * and should not be used for another accepting number in another
 	 * state.
 	 */
-	chk[position - 1] = 1;
+	SET_CHK (position - 1, 1);
 
 	/* Put in end-of-buffer marker; this is for the same purposes as
 	 * above.
 	 */
-	chk[position] = 1;
+	SET_CHK (position, 1);
 
 	/* Place the state into chk and nxt. */
 	state_ptr = &state[1];
 
 	for (i = 1; i <= numecs; ++i, ++state_ptr)
 		if (*state_ptr != 0) {
-			chk[position + i] = i;
+			SET_CHK (position + i, i);
 			nxt[position + i] = *state_ptr;
 		}
 
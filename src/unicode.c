@@ -0,0 +1,1262 @@
+/* unicode - Unicode general categories for UTF-8 character classes */
+
+/*  Copyright (c) 1990 The Regents of the University of California. */
+/*  All rights reserved. */
+
+/*  This code is derived from software contributed to Berkeley by */
+/*  Vern Paxson. */
+
+/*  The United States Government has rights in this work pursuant */
+/*  to contract no. DE-AC03-76SF00098 between the United States */
+ /*  Department of Energy and the University of California. */
+
+/*  This file is part of flex. */
+
+/*  Redistribution and use in source and binary forms, with or without */
+/*  modification, are permitted provided that the following conditions */
+/*  are met: */
+
+/*  1. Redistributions of source code must retain the above copyright */
+/*     notice, this list of conditions and the following disclaimer. */
+/*  2. Redistributions in binary form must reproduce the above copyright */
+/*     notice, this list of conditions and the following disclaimer in the */
+/*     documentation and/or other materials provided with the distribution. */
+
+/*  Neither the name of the University nor the names of its contributors */
+/*  may be used to endorse or promote products derived from this software */
+/*  without specific prior written permission. */
+
+/*  THIS SOFTWARE IS PROVIDED ``AS IS'' AND WITHOUT ANY EXPRESS OR */
+/*  IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED */
+/*  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR */
+/*  PURPOSE. */
+
+#include "flexdef.h"
+
+
+/* The general categories flex knows about, as bits in a property mask. */
+enum uni_category {
+	UC_Lu = 0,
+	UC_Ll,
+	UC_Lt,
+	UC_Lm,
+	UC_Lo,
+	UC_Mn,
+	UC_Mc,
+	UC_Me,
+	UC_Nd,
+	UC_Nl,
+	UC_No,
+	UC_Pc,
+	UC_Pd,
+	UC_Ps,
+	UC_Pe,
+	UC_Pi,
+	UC_Pf,
+	UC_Po,
+	UC_Sm,
+	UC_Sc,
+	UC_Sk,
+	UC_So,
+	UC_Zs,
+	UC_Zl,
+	UC_Zp,
+	UC_Cc,
+	UC_Cf
+};
+
+#define UC(cat) (1 << UC_ ## cat)
+
+static const struct uni_property {
+	const char *name;
+	int     mask;
+} uni_properties[] = {
+	{"L", UC(Lu) | UC(Ll) | UC(Lt) | UC(Lm) | UC(Lo)},
+	{"Lu", UC(Lu)},
+	{"Ll", UC(Ll)},
+	{"Lt", UC(Lt)},
+	{"Lm", UC(Lm)},
+	{"Lo", UC(Lo)},
+	{"M", UC(Mn) | UC(Mc) | UC(Me)},
+	{"Mn", UC(Mn)},
+	{"Mc", UC(Mc)},
+	{"Me", UC(Me)},
+	{"N", UC(Nd) | UC(Nl) | UC(No)},
+	{"Nd", UC(Nd)},
+	{"Nl", UC(Nl)},
+	{"No", UC(No)},
+	{"P", UC(Pc) | UC(Pd) | UC(Ps) | UC(Pe) | UC(Pi) | UC(Pf) | UC(Po)},
+	{"Pc", UC(Pc)},
+	{"Pd", UC(Pd)},
+	{"Ps", UC(Ps)},
+	{"Pe", UC(Pe)},
+	{"Pi", UC(Pi)},
+	{"Pf", UC(Pf)},
+	{"Po", UC(Po)},
+	{"S", UC(Sm) | UC(Sc) | UC(Sk) | UC(So)},
+	{"Sm", UC(Sm)},
+	{"Sc", UC(Sc)},
+	{"Sk", UC(Sk)},
+	{"So", UC(So)},
+	{"Z", UC(Zs) | UC(Zl) | UC(Zp)},
+	{"Zs", UC(Zs)},
+	{"Zl", UC(Zl)},
+	{"Zp", UC(Zp)},
+	{"Cc", UC(Cc)},
+	{"Cf", UC(Cf)},
+	{0, 0}
+};
+
+/* The code points in each category, in order.  Generated from the
+ * Unicode 14.0.0 character database; unassigned, private-use and
+ * surrogate code points are left out.
+ */
+
+static const struct uni_range {
+	int     first, last, cat;
+} uni_ranges[] = {
+	{0x0000, 0x001f, UC_Cc}, {0x0020, 0x0020, UC_Zs}, {0x0021, 0x0023, UC_Po},
+	{0x0024, 0x0024, UC_Sc}, {0x0025, 0x0027, UC_Po}, {0x0028, 0x0028, UC_Ps},
+	{0x0029, 0x0029, UC_Pe}, {0x002a, 0x002a, UC_Po}, {0x002b, 0x002b, UC_Sm},
+	{0x002c, 0x002c, UC_Po}, {0x002d, 0x002d, UC_Pd}, {0x002e, 0x002f, UC_Po},
+	{0x0030, 0x0039, UC_Nd}, {0x003a, 0x003b, UC_Po}, {0x003c, 0x003e, UC_Sm},
+	{0x003f, 0x0040, UC_Po}, {0x0041, 0x005a, UC_Lu}, {0x005b, 0x005b, UC_Ps},
+	{0x005c, 0x005c, UC_Po}, {0x005d, 0x005d, UC_Pe}, {0x005e, 0x005e, UC_Sk},
+	{0x005f, 0x005f, UC_Pc}, {0x0060, 0x0060, UC_Sk}, {0x0061, 0x007a, UC_Ll},
+	{0x007b, 0x007b, UC_Ps}, {0x007c, 0x007c, UC_Sm}, {0x007d, 0x007d, UC_Pe},
+	{0x007e, 0x007e, UC_Sm}, {0x007f, 0x009f, UC_Cc}, {0x00a0, 0x00a0, UC_Zs},
+	{0x00a1, 0x00a1, UC_Po}, {0x00a2, 0x00a5, UC_Sc}, {0x00a6, 0x00a6, UC_So},
+	{0x00a7, 0x00a7, UC_Po}, {0x00a8, 0x00a8, UC_Sk}, {0x00a9, 0x00a9, UC_So},
+	{0x00aa, 0x00aa, UC_Lo}, {0x00ab, 0x00ab, UC_Pi}, {0x00ac, 0x00ac, UC_Sm},
+	{0x00ad, 0x00ad, UC_Cf}, {0x00ae, 0x00ae, UC_So}, {0x00af, 0x00af, UC_Sk},
+	{0x00b0, 0x00b0, UC_So}, {0x00b1, 0x00b1, UC_Sm}, {0x00b2, 0x00b3, UC_No},
+	{0x00b4, 0x00b4, UC_Sk}, {0x00b5, 0x00b5, UC_Ll}, {0x00b6, 0x00b7, UC_Po},
+	{0x00b8, 0x00b8, UC_Sk}, {0x00b9, 0x00b9, UC_No}, {0x00ba, 0x00ba, UC_Lo},
+	{0x00bb, 0x00bb, UC_Pf}, {0x00bc, 0x00be, UC_No}, {0x00bf, 0x00bf, UC_Po},
+	{0x00c0, 0x00d6, UC_Lu}, {0x00d7, 0x00d7, UC_Sm}, {0x00d8, 0x00de, UC_Lu},
+	{0x00df, 0x00f6, UC_Ll}, {0x00f7, 0x00f7, UC_Sm}, {0x00f8, 0x00ff, UC_Ll},
+	{0x0100, 0x0100, UC_Lu}, {0x0101, 0x0101, UC_Ll}, {0x0102, 0x0102, UC_Lu},
+	{0x0103, 0x0103, UC_Ll}, {0x0104, 0x0104, UC_Lu}, {0x0105, 0x0105, UC_Ll},
+	{0x0106, 0x0106, UC_Lu}, {0x0107, 0x0107, UC_Ll}, {0x0108, 0x0108, UC_Lu},
+	{0x0109, 0x0109, UC_Ll}, {0x010a, 0x010a, UC_Lu}, {0x010b, 0x010b, UC_Ll},
+	{0x010c, 0x010c, UC_Lu}, {0x010d, 0x010d, UC_Ll}, {0x010e, 0x010e, UC_Lu},
+	{0x010f, 0x010f, UC_Ll}, {0x0110, 0x0110, UC_Lu}, {0x0111, 0x0111, UC_Ll},
+	{0x0112, 0x0112, UC_Lu}, {0x0113, 0x0113, UC_Ll}, {0x0114, 0x0114, UC_Lu},
+	{0x0115, 0x0115, UC_Ll}, {0x0116, 0x0116, UC_Lu}, {0x0117, 0x0117, UC_Ll},
+	{0x0118, 0x0118, UC_Lu}, {0x0119, 0x0119, UC_Ll}, {0x011a, 0x011a, UC_Lu},
+	{0x011b, 0x011b, UC_Ll}, {0x011c, 0x011c, UC_Lu}, {0x011d, 0x011d, UC_Ll},
+	{0x011e, 0x011e, UC_Lu}, {0x011f, 0x011f, UC_Ll}, {0x0120, 0x0120, UC_Lu},
+	{0x0121, 0x0121, UC_Ll}, {0x0122, 0x0122, UC_Lu}, {0x0123, 0x0123, UC_Ll},
+	{0x0124, 0x0124, UC_Lu}, {0x0125, 0x0125, UC_Ll}, {0x0126, 0x0126, UC_Lu},
+	{0x0127, 0x0127, UC_Ll}, {0x0128, 0x0128, UC_Lu}, {0x0129, 0x0129, UC_Ll},
+	{0x012a, 0x012a, UC_Lu}, {0x012b, 0x012b, UC_Ll}, {0x012c, 0x012c, UC_Lu},
+	{0x012d, 0x012d, UC_Ll}, {0x012e, 0x012e, UC_Lu}, {0x012f, 0x012f, UC_Ll},
+	{0x0130, 0x0130, UC_Lu}, {0x0131, 0x0131, UC_Ll}, {0x0132, 0x0132, UC_Lu},
+	{0x0133, 0x0133, UC_Ll}, {0x0134, 0x0134, UC_Lu}, {0x0135, 0x0135, UC_Ll},
+	{0x0136, 0x0136, UC_Lu}, {0x0137, 0x0138, UC_Ll}, {0x0139, 0x0139, UC_Lu},
+	{0x013a, 0x013a, UC_Ll}, {0x013b, 0x013b, UC_Lu}, {0x013c, 0x013c, UC_Ll},
+	{0x013d, 0x013d, UC_Lu}, {0x013e, 0x013e, UC_Ll}, {0x013f, 0x013f, UC_Lu},
+	{0x0140, 0x0140, UC_Ll}, {0x0141, 0x0141, UC_Lu}, {0x0142, 0x0142, UC_Ll},
+	{0x0143, 0x0143, UC_Lu}, {0x0144, 0x0144, UC_Ll}, {0x0145, 0x0145, UC_Lu},
+	{0x0146, 0x0146, UC_Ll}, {0x0147, 0x0147, UC_Lu}, {0x0148, 0x0149, UC_Ll},
+	{0x014a, 0x014a, UC_Lu}, {0x014b, 0x014b, UC_Ll}, {0x014c, 0x014c, UC_Lu},
+	{0x014d, 0x014d, UC_Ll}, {0x014e, 0x014e, UC_Lu}, {0x014f, 0x014f, UC_Ll},
+	{0x0150, 0x0150, UC_Lu}, {0x0151, 0x0151, UC_Ll}, {0x0152, 0x0152, UC_Lu},
+	{0x0153, 0x0153, UC_Ll}, {0x0154, 0x0154, UC_Lu}, {0x0155, 0x0155, UC_Ll},
+	{0x0156, 0x0156, UC_Lu}, {0x0157, 0x0157, UC_Ll}, {0x0158, 0x0158, UC_Lu},
+	{0x0159, 0x0159, UC_Ll}, {0x015a, 0x015a, UC_Lu}, {0x015b, 0x015b, UC_Ll},
+	{0x015c, 0x015c, UC_Lu}, {0x015d, 0x015d, UC_Ll}, {0x015e, 0x015e, UC_Lu},
+	{0x015f, 0x015f, UC_Ll}, {0x0160, 0x0160, UC_Lu}, {0x0161, 0x0161, UC_Ll},
+	{0x0162, 0x0162, UC_Lu}, {0x0163, 0x0163, UC_Ll}, {0x0164, 0x0164, UC_Lu},
+	{0x0165, 0x0165, UC_Ll}, {0x0166, 0x0166, UC_Lu}, {0x0167, 0x0167, UC_Ll},
+	{0x0168, 0x0168, UC_Lu}, {0x0169, 0x0169, UC_Ll}, {0x016a, 0x016a, UC_Lu},
+	{0x016b, 0x016b, UC_Ll}, {0x016c, 0x016c, UC_Lu}, {0x016d, 0x016d, UC_Ll},
+	{0x016e, 0x016e, UC_Lu}, {0x016f, 0x016f, UC_Ll}, {0x0170, 0x0170, UC_Lu},
+	{0x0171, 0x0171, UC_Ll}, {0x0172, 0x0172, UC_Lu}, {0x0173, 0x0173, UC_Ll},
+	{0x0174, 0x0174, UC_Lu}, {0x0175, 0x0175, UC_Ll}, {0x0176, 0x0176, UC_Lu},
+	{0x0177, 0x0177, UC_Ll}, {0x0178, 0x0179, UC_Lu}, {0x017a, 0x017a, UC_Ll},
+	{0x017b, 0x017b, UC_Lu}, {0x017c, 0x017c, UC_Ll}, {0x017d, 0x017d, UC_Lu},
+	{0x017e, 0x0180, UC_Ll}, {0x0181, 0x0182, UC_Lu}, {0x0183, 0x0183, UC_Ll},
+	{0x0184, 0x0184, UC_Lu}, {0x0185, 0x0185, UC_Ll}, {0x0186, 0x0187, UC_Lu},
+	{0x0188, 0x0188, UC_Ll}, {0x0189, 0x018b, UC_Lu}, {0x018c, 0x018d, UC_Ll},
+	{0x018e, 0x0191, UC_Lu}, {0x0192, 0x0192, UC_Ll}, {0x0193, 0x0194, UC_Lu},
+	{0x0195, 0x0195, UC_Ll}, {0x0196, 0x0198, UC_Lu}, {0x0199, 0x019b, UC_Ll},
+	{0x019c, 0x019d, UC_Lu}, {0x019e, 0x019e, UC_Ll}, {0x019f, 0x01a0, UC_Lu},
+	{0x01a1, 0x01a1, UC_Ll}, {0x01a2, 0x01a2, UC_Lu}, {0x01a3, 0x01a3, UC_Ll},
+	{0x01a4, 0x01a4, UC_Lu}, {0x01a5, 0x01a5, UC_Ll}, {0x01a6, 0x01a7, UC_Lu},
+	{0x01a8, 0x01a8, UC_Ll}, {0x01a9, 0x01a9, UC_Lu}, {0x01aa, 0x01ab, UC_Ll},
+	{0x01ac, 0x01ac, UC_Lu}, {0x01ad, 0x01ad, UC_Ll}, {0x01ae, 0x01af, UC_Lu},
+	{0x01b0, 0x01b0, UC_Ll}, {0x01b1, 0x01b3, UC_Lu}, {0x01b4, 0x01b4, UC_Ll},
+	{0x01b5, 0x01b5, UC_Lu}, {0x01b6, 0x01b6, UC_Ll}, {0x01b7, 0x01b8, UC_Lu},
+	{0x01b9, 0x01ba, UC_Ll}, {0x01bb, 0x01bb, UC_Lo}, {0x01bc, 0x01bc, UC_Lu},
+	{0x01bd, 0x01bf, UC_Ll}, {0x01c0, 0x01c3, UC_Lo}, {0x01c4, 0x01c4, UC_Lu},
+	{0x01c5, 0x01c5, UC_Lt}, {0x01c6, 0x01c6, UC_Ll}, {0x01c7, 0x01c7, UC_Lu},
+	{0x01c8, 0x01c8, UC_Lt}, {0x01c9, 0x01c9, UC_Ll}, {0x01ca, 0x01ca, UC_Lu},
+	{0x01cb, 0x01cb, UC_Lt}, {0x01cc, 0x01cc, UC_Ll}, {0x01cd, 0x01cd, UC_Lu},
+	{0x01ce, 0x01ce, UC_Ll}, {0x01cf, 0x01cf, UC_Lu}, {0x01d0, 0x01d0, UC_Ll},
+	{0x01d1, 0x01d1, UC_Lu}, {0x01d2, 0x01d2, UC_Ll}, {0x01d3, 0x01d3, UC_Lu},
+	{0x01d4, 0x01d4, UC_Ll}, {0x01d5, 0x01d5, UC_Lu}, {0x01d6, 0x01d6, UC_Ll},
+	{0x01d7, 0x01d7, UC_Lu}, {0x01d8, 0x01d8, UC_Ll}, {0x01d9, 0x01d9, UC_Lu},
+	{0x01da, 0x01da, UC_Ll}, {0x01db, 0x01db, UC_Lu}, {0x01dc, 0x01dd, UC_Ll},
+	{0x01de, 0x01de, UC_Lu}, {0x01df, 0x01df, UC_Ll}, {0x01e0, 0x01e0, UC_Lu},
+	{0x01e1, 0x01e1, UC_Ll}, {0x01e2, 0x01e2, UC_Lu}, {0x01e3, 0x01e3, UC_Ll},
+	{0x01e4, 0x01e4, UC_Lu}, {0x01e5, 0x01e5, UC_Ll}, {0x01e6, 0x01e6, UC_Lu},
+	{0x01e7, 0x01e7, UC_Ll}, {0x01e8, 0x01e8, UC_Lu}, {0x01e9, 0x01e9, UC_Ll},
+	{0x01ea, 0x01ea, UC_Lu}, {0x01eb, 0x01eb, UC_Ll}, {0x01ec, 0x01ec, UC_Lu},
+	{0x01ed, 0x01ed, UC_Ll}, {0x01ee, 0x01ee, UC_Lu}, {0x01ef, 0x01f0, UC_Ll},
+	{0x01f1, 0x01f1, UC_Lu}, {0x01f2, 0x01f2, UC_Lt}, {0x01f3, 0x01f3, UC_Ll},
+	{0x01f4, 0x01f4, UC_Lu}, {0x01f5, 0x01f5, UC_Ll}, {0x01f6, 0x01f8, UC_Lu},
+	{0x01f9, 0x01f9, UC_Ll}, {0x01fa, 0x01fa, UC_Lu}, {0x01fb, 0x01fb, UC_Ll},
+	{0x01fc, 0x01fc, UC_Lu}, {0x01fd, 0x01fd, UC_Ll}, {0x01fe, 0x01fe, UC_Lu},
+	{0x01ff, 0x01ff, UC_Ll}, {0x0200, 0x0200, UC_Lu}, {0x0201, 0x0201, UC_Ll},
+	{0x0202, 0x0202, UC_Lu}, {0x0203, 0x0203, UC_Ll}, {0x0204, 0x0204, UC_Lu},
+	{0x0205, 0x0205, UC_Ll}, {0x0206, 0x0206, UC_Lu}, {0x0207, 0x0207, UC_Ll},
+	{0x0208, 0x0208, UC_Lu}, {0x0209, 0x0209, UC_Ll}, {0x020a, 0x020a, UC_Lu},
+	{0x020b, 0x020b, UC_Ll}, {0x020c, 0x020c, UC_Lu}, {0x020d, 0x020d, UC_Ll},
+	{0x020e, 0x020e, UC_Lu}, {0x020f, 0x020f, UC_Ll}, {0x0210, 0x0210, UC_Lu},
+	{0x0211, 0x0211, UC_Ll}, {0x0212, 0x0212, UC_Lu}, {0x0213, 0x0213, UC_Ll},
+	{0x0214, 0x0214, UC_Lu}, {0x0215, 0x0215, UC_Ll}, {0x0216, 0x0216, UC_Lu},
+	{0x0217, 0x0217, UC_Ll}, {0x0218, 0x0218, UC_Lu}, {0x0219, 0x0219, UC_Ll},
+	{0x021a, 0x021a, UC_Lu}, {0x021b, 0x021b, UC_Ll}, {0x021c, 0x021c, UC_Lu},
+	{0x021d, 0x021d, UC_Ll}, {0x021e, 0x021e, UC_Lu}, {0x021f, 0x021f, UC_Ll},
+	{0x0220, 0x0220, UC_Lu}, {0x0221, 0x0221, UC_Ll}, {0x0222, 0x0222, UC_Lu},
+	{0x0223, 0x0223, UC_Ll}, {0x0224, 0x0224, UC_Lu}, {0x0225, 0x0225, UC_Ll},
+	{0x0226, 0x0226, UC_Lu}, {0x0227, 0x0227, UC_Ll}, {0x0228, 0x0228, UC_Lu},
+	{0x0229, 0x0229, UC_Ll}, {0x022a, 0x022a, UC_Lu}, {0x022b, 0x022b, UC_Ll},
+	{0x022c, 0x022c, UC_Lu}, {0x022d, 0x022d, UC_Ll}, {0x022e, 0x022e, UC_Lu},
+	{0x022f, 0x022f, UC_Ll}, {0x0230, 0x0230, UC_Lu}, {0x0231, 0x0231, UC_Ll},
+	{0x0232, 0x0232, UC_Lu}, {0x0233, 0x0239, UC_Ll}, {0x023a, 0x023b, UC_Lu},
+	{0x023c, 0x023c, UC_Ll}, {0x023d, 0x023e, UC_Lu}, {0x023f, 0x0240, UC_Ll},
+	{0x0241, 0x0241, UC_Lu}, {0x0242, 0x0242, UC_Ll}, {0x0243, 0x0246, UC_Lu},
+	{0x0247, 0x0247, UC_Ll}, {0x0248, 0x0248, UC_Lu}, {0x0249, 0x0249, UC_Ll},
+	{0x024a, 0x024a, UC_Lu}, {0x024b, 0x024b, UC_Ll}, {0x024c, 0x024c, UC_Lu},
+	{0x024d, 0x024d, UC_Ll}, {0x024e, 0x024e, UC_Lu}, {0x024f, 0x0293, UC_Ll},
+	{0x0294, 0x0294, UC_Lo}, {0x0295, 0x02af, UC_Ll}, {0x02b0, 0x02c1, UC_Lm},
+	{0x02c2, 0x02c5, UC_Sk}, {0x02c6, 0x02d1, UC_Lm}, {0x02d2, 0x02df, UC_Sk},
+	{0x02e0, 0x02e4, UC_Lm}, {0x02e5, 0x02eb, UC_Sk}, {0x02ec, 0x02ec, UC_Lm},
+	{0x02ed, 0x02ed, UC_Sk}, {0x02ee, 0x02ee, UC_Lm}, {0x02ef, 0x02ff, UC_Sk},
+	{0x0300, 0x036f, UC_Mn}, {0x0370, 0x0370, UC_Lu}, {0x0371, 0x0371, UC_Ll},
+	{0x0372, 0x0372, UC_Lu}, {0x0373, 0x0373, UC_Ll}, {0x0374, 0x0374, UC_Lm},
+	{0x0375, 0x0375, UC_Sk}, {0x0376, 0x0376, UC_Lu}, {0x0377, 0x0377, UC_Ll},
+	{0x037a, 0x037a, UC_Lm}, {0x037b, 0x037d, UC_Ll}, {0x037e, 0x037e, UC_Po},
+	{0x037f, 0x037f, UC_Lu}, {0x0384, 0x0385, UC_Sk}, {0x0386, 0x0386, UC_Lu},
+	{0x0387, 0x0387, UC_Po}, {0x0388, 0x038a, UC_Lu}, {0x038c, 0x038c, UC_Lu},
+	{0x038e, 0x038f, UC_Lu}, {0x0390, 0x0390, UC_Ll}, {0x0391, 0x03a1, UC_Lu},
+	{0x03a3, 0x03ab, UC_Lu}, {0x03ac, 0x03ce, UC_Ll}, {0x03cf, 0x03cf, UC_Lu},
+	{0x03d0, 0x03d1, UC_Ll}, {0x03d2, 0x03d4, UC_Lu}, {0x03d5, 0x03d7, UC_Ll},
+	{0x03d8, 0x03d8, UC_Lu}, {0x03d9, 0x03d9, UC_Ll}, {0x03da, 0x03da, UC_Lu},
+	{0x03db, 0x03db, UC_Ll}, {0x03dc, 0x03dc, UC_Lu}, {0x03dd, 0x03dd, UC_Ll},
+	{0x03de, 0x03de, UC_Lu}, {0x03df, 0x03df, UC_Ll}, {0x03e0, 0x03e0, UC_Lu},
+	{0x03e1, 0x03e1, UC_Ll}, {0x03e2, 0x03e2, UC_Lu}, {0x03e3, 0x03e3, UC_Ll},
+	{0x03e4, 0x03e4, UC_Lu}, {0x03e5, 0x03e5, UC_Ll}, {0x03e6, 0x03e6, UC_Lu},
+	{0x03e7, 0x03e7, UC_Ll}, {0x03e8, 0x03e8, UC_Lu}, {0x03e9, 0x03e9, UC_Ll},
+	{0x03ea, 0x03ea, UC_Lu}, {0x03eb, 0x03eb, UC_Ll}, {0x03ec, 0x03ec, UC_Lu},
+	{0x03ed, 0x03ed, UC_Ll}, {0x03ee, 0x03ee, UC_Lu}, {0x03ef, 0x03f3, UC_Ll},
+	{0x03f4, 0x03f4, UC_Lu}, {0x03f5, 0x03f5, UC_Ll}, {0x03f6, 0x03f6, UC_Sm},
+	{0x03f7, 0x03f7, UC_Lu}, {0x03f8, 0x03f8, UC_Ll}, {0x03f9, 0x03fa, UC_Lu},
+	{0x03fb, 0x03fc, UC_Ll}, {0x03fd, 0x042f, UC_Lu}, {0x0430, 0x045f, UC_Ll},
+	{0x0460, 0x0460, UC_Lu}, {0x0461, 0x0461, UC_Ll}, {0x0462, 0x0462, UC_Lu},
+	{0x0463, 0x0463, UC_Ll}, {0x0464, 0x0464, UC_Lu}, {0x0465, 0x0465, UC_Ll},
+	{0x0466, 0x0466, UC_Lu}, {0x0467, 0x0467, UC_Ll}, {0x0468, 0x0468, UC_Lu},
+	{0x0469, 0x0469, UC_Ll}, {0x046a, 0x046a, UC_Lu}, {0x046b, 0x046b, UC_Ll},
+	{0x046c, 0x046c, UC_Lu}, {0x046d, 0x046d, UC_Ll}, {0x046e, 0x046e, UC_Lu},
+	{0x046f, 0x046f, UC_Ll}, {0x0470, 0x0470, UC_Lu}, {0x0471, 0x0471, UC_Ll},
+	{0x0472, 0x0472, UC_Lu}, {0x0473, 0x0473, UC_Ll}, {0x0474, 0x0474, UC_Lu},
+	{0x0475, 0x0475, UC_Ll}, {0x0476, 0x0476, UC_Lu}, {0x0477, 0x0477, UC_Ll},
+	{0x0478, 0x0478, UC_Lu}, {0x0479, 0x0479, UC_Ll}, {0x047a, 0x047a, UC_Lu},
+	{0x047b, 0x047b, UC_Ll}, {0x047c, 0x047c, UC_Lu}, {0x047d, 0x047d, UC_Ll},
+	{0x047e, 0x047e, UC_Lu}, {0x047f, 0x047f, UC_Ll}, {0x0480, 0x0480, UC_Lu},
+	{0x0481, 0x0481, UC_Ll}, {0x0482, 0x0482, UC_So}, {0x0483, 0x0487, UC_Mn},
+	{0x0488, 0x0489, UC_Me}, {0x048a, 0x048a, UC_Lu}, {0x048b, 0x048b, UC_Ll},
+	{0x048c, 0x048c, UC_Lu}, {0x048d, 0x048d, UC_Ll}, {0x048e, 0x048e, UC_Lu},
+	{0x048f, 0x048f, UC_Ll}, {0x0490, 0x0490, UC_Lu}, {0x0491, 0x0491, UC_Ll},
+	{0x0492, 0x0492, UC_Lu}, {0x0493, 0x0493, UC_Ll}, {0x0494, 0x0494, UC_Lu},
+	{0x0495, 0x0495, UC_Ll}, {0x0496, 0x0496, UC_Lu}, {0x0497, 0x0497, UC_Ll},
+	{0x0498, 0x0498, UC_Lu}, {0x0499, 0x0499, UC_Ll}, {0x049a, 0x049a, UC_Lu},
+	{0x049b, 0x049b, UC_Ll}, {0x049c, 0x049c, UC_Lu}, {0x049d, 0x049d, UC_Ll},
+	{0x049e, 0x049e, UC_Lu}, {0x049f, 0x049f, UC_Ll}, {0x04a0, 0x04a0, UC_Lu},
+	{0x04a1, 0x04a1, UC_Ll}, {0x04a2, 0x04a2, UC_Lu}, {0x04a3, 0x04a3, UC_Ll},
+	{0x04a4, 0x04a4, UC_Lu}, {0x04a5, 0x04a5, UC_Ll}, {0x04a6, 0x04a6, UC_Lu},
+	{0x04a7, 0x04a7, UC_Ll}, {0x04a8, 0x04a8, UC_Lu}, {0x04a9, 0x04a9, UC_Ll},
+	{0x04aa, 0x04aa, UC_Lu}, {0x04ab, 0x04ab, UC_Ll}, {0x04ac, 0x04ac, UC_Lu},
+	{0x04ad, 0x04ad, UC_Ll}, {0x04ae, 0x04ae, UC_Lu}, {0x04af, 0x04af, UC_Ll},
+	{0x04b0, 0x04b0, UC_Lu}, {0x04b1, 0x04b1, UC_Ll}, {0x04b2, 0x04b2, UC_Lu},
+	{0x04b3, 0x04b3, UC_Ll}, {0x04b4, 0x04b4, UC_Lu}, {0x04b5, 0x04b5, UC_Ll},
+	{0x04b6, 0x04b6, UC_Lu}, {0x04b7, 0x04b7, UC_Ll}, {0x04b8, 0x04b8, UC_Lu},
+	{0x04b9, 0x04b9, UC_Ll}, {0x04ba, 0x04ba, UC_Lu}, {0x04bb, 0x04bb, UC_Ll},
+	{0x04bc, 0x04bc, UC_Lu}, {0x04bd, 0x04bd, UC_Ll}, {0x04be, 0x04be, UC_Lu},
+	{0x04bf, 0x04bf, UC_Ll}, {0x04c0, 0x04c1, UC_Lu}, {0x04c2, 0x04c2, UC_Ll},
+	{0x04c3, 0x04c3, UC_Lu}, {0x04c4, 0x04c4, UC_Ll}, {0x04c5, 0x04c5, UC_Lu},
+	{0x04c6, 0x04c6, UC_Ll}, {0x04c7, 0x04c7, UC_Lu}, {0x04c8, 0x04c8, UC_Ll},
+	{0x04c9, 0x04c9, UC_Lu}, {0x04ca, 0x04ca, UC_Ll}, {0x04cb, 0x04cb, UC_Lu},
+	{0x04cc, 0x04cc, UC_Ll}, {0x04cd, 0x04cd, UC_Lu}, {0x04ce, 0x04cf, UC_Ll},
+	{0x04d0, 0x04d0, UC_Lu}, {0x04d1, 0x04d1, UC_Ll}, {0x04d2, 0x04d2, UC_Lu},
+	{0x04d3, 0x04d3, UC_Ll}, {0x04d4, 0x04d4, UC_Lu}, {0x04d5, 0x04d5, UC_Ll},
+	{0x04d6, 0x04d6, UC_Lu}, {0x04d7, 0x04d7, UC_Ll}, {0x04d8, 0x04d8, UC_Lu},
+	{0x04d9, 0x04d9, UC_Ll}, {0x04da, 0x04da, UC_Lu}, {0x04db, 0x04db, UC_Ll},
+	{0x04dc, 0x04dc, UC_Lu}, {0x04dd, 0x04dd, UC_Ll}, {0x04de, 0x04de, UC_Lu},
+	{0x04df, 0x04df, UC_Ll}, {0x04e0, 0x04e0, UC_Lu}, {0x04e1, 0x04e1, UC_Ll},
+	{0x04e2, 0x04e2, UC_Lu}, {0x04e3, 0x04e3, UC_Ll}, {0x04e4, 0x04e4, UC_Lu},
+	{0x04e5, 0x04e5, UC_Ll}, {0x04e6, 0x04e6, UC_Lu}, {0x04e7, 0x04e7, UC_Ll},
+	{0x04e8, 0x04e8, UC_Lu}, {0x04e9, 0x04e9, UC_Ll}, {0x04ea, 0x04ea, UC_Lu},
+	{0x04eb, 0x04eb, UC_Ll}, {0x04ec, 0x04ec, UC_Lu}, {0x04ed, 0x04ed, UC_Ll},
+	{0x04ee, 0x04ee, UC_Lu}, {0x04ef, 0x04ef, UC_Ll}, {0x04f0, 0x04f0, UC_Lu},
+	{0x04f1, 0x04f1, UC_Ll}, {0x04f2, 0x04f2, UC_Lu}, {0x04f3, 0x04f3, UC_Ll},
+	{0x04f4, 0x04f4, UC_Lu}, {0x04f5, 0x04f5, UC_Ll}, {0x04f6, 0x04f6, UC_Lu},
+	{0x04f7, 0x04f7, UC_Ll}, {0x04f8, 0x04f8, UC_Lu}, {0x04f9, 0x04f9, UC_Ll},
+	{0x04fa, 0x04fa, UC_Lu}, {0x04fb, 0x04fb, UC_Ll}, {0x04fc, 0x04fc, UC_Lu},
+	{0x04fd, 0x04fd, UC_Ll}, {0x04fe, 0x04fe, UC_Lu}, {0x04ff, 0x04ff, UC_Ll},
+	{0x0500, 0x0500, UC_Lu}, {0x0501, 0x0501, UC_Ll}, {0x0502, 0x0502, UC_Lu},
+	{0x0503, 0x0503, UC_Ll}, {0x0504, 0x0504, UC_Lu}, {0x0505, 0x0505, UC_Ll},
+	{0x0506, 0x0506, UC_Lu}, {0x0507, 0x0507, UC_Ll}, {0x0508, 0x0508, UC_Lu},
+	{0x0509, 0x0509, UC_Ll}, {0x050a, 0x050a, UC_Lu}, {0x050b, 0x050b, UC_Ll},
+	{0x050c, 0x050c, UC_Lu}, {0x050d, 0x050d, UC_Ll}, {0x050e, 0x050e, UC_Lu},
+	{0x050f, 0x050f, UC_Ll}, {0x0510, 0x0510, UC_Lu}, {0x0511, 0x0511, UC_Ll},
+	{0x0512, 0x0512, UC_Lu}, {0x0513, 0x0513, UC_Ll}, {0x0514, 0x0514, UC_Lu},
+	{0x0515, 0x0515, UC_Ll}, {0x0516, 0x0516, UC_Lu}, {0x0517, 0x0517, UC_Ll},
+	{0x0518, 0x0518, UC_Lu}, {0x0519, 0x0519, UC_Ll}, {0x051a, 0x051a, UC_Lu},
+	{0x051b, 0x051b, UC_Ll}, {0x051c, 0x051c, UC_Lu}, {0x051d, 0x051d, UC_Ll},
+	{0x051e, 0x051e, UC_Lu}, {0x051f, 0x051f, UC_Ll}, {0x0520, 0x0520, UC_Lu},
+	{0x0521, 0x0521, UC_Ll}, {0x0522, 0x0522, UC_Lu}, {0x0523, 0x0523, UC_Ll},
+	{0x0524, 0x0524, UC_Lu}, {0x0525, 0x0525, UC_Ll}, {0x0526, 0x0526, UC_Lu},
+	{0x0527, 0x0527, UC_Ll}, {0x0528, 0x0528, UC_Lu}, {0x0529, 0x0529, UC_Ll},
+	{0x052a, 0x052a, UC_Lu}, {0x052b, 0x052b, UC_Ll}, {0x052c, 0x052c, UC_Lu},
+	{0x052d, 0x052d, UC_Ll}, {0x052e, 0x052e, UC_Lu}, {0x052f, 0x052f, UC_Ll},
+	{0x0531, 0x0556, UC_Lu}, {0x0559, 0x0559, UC_Lm}, {0x055a, 0x055f, UC_Po},
+	{0x0560, 0x0588, UC_Ll}, {0x0589, 0x0589, UC_Po}, {0x058a, 0x058a, UC_Pd},
+	{0x058d, 0x058e, UC_So}, {0x058f, 0x058f, UC_Sc}, {0x0591, 0x05bd, UC_Mn},
+	{0x05be, 0x05be, UC_Pd}, {0x05bf, 0x05bf, UC_Mn}, {0x05c0, 0x05c0, UC_Po},
+	{0x05c1, 0x05c2, UC_Mn}, {0x05c3, 0x05c3, UC_Po}, {0x05c4, 0x05c5, UC_Mn},
+	{0x05c6, 0x05c6, UC_Po}, {0x05c7, 0x05c7, UC_Mn}, {0x05d0, 0x05ea, UC_Lo},
+	{0x05ef, 0x05f2, UC_Lo}, {0x05f3, 0x05f4, UC_Po}, {0x0600, 0x0605, UC_Cf},
+	{0x0606, 0x0608, UC_Sm}, {0x0609, 0x060a, UC_Po}, {0x060b, 0x060b, UC_Sc},
+	{0x060c, 0x060d, UC_Po}, {0x060e, 0x060f, UC_So}, {0x0610, 0x061a, UC_Mn},
+	{0x061b, 0x061b, UC_Po}, {0x061c, 0x061c, UC_Cf}, {0x061d, 0x061f, UC_Po},
+	{0x0620, 0x063f, UC_Lo}, {0x0640, 0x0640, UC_Lm}, {0x0641, 0x064a, UC_Lo},
+	{0x064b, 0x065f, UC_Mn}, {0x0660, 0x0669, UC_Nd}, {0x066a, 0x066d, UC_Po},
+	{0x066e, 0x066f, UC_Lo}, {0x0670, 0x0670, UC_Mn}, {0x0671, 0x06d3, UC_Lo},
+	{0x06d4, 0x06d4, UC_Po}, {0x06d5, 0x06d5, UC_Lo}, {0x06d6, 0x06dc, UC_Mn},
+	{0x06dd, 0x06dd, UC_Cf}, {0x06de, 0x06de, UC_So}, {0x06df, 0x06e4, UC_Mn},
+	{0x06e5, 0x06e6, UC_Lm}, {0x06e7, 0x06e8, UC_Mn}, {0x06e9, 0x06e9, UC_So},
+	{0x06ea, 0x06ed, UC_Mn}, {0x06ee, 0x06ef, UC_Lo}, {0x06f0, 0x06f9, UC_Nd},
+	{0x06fa, 0x06fc, UC_Lo}, {0x06fd, 0x06fe, UC_So}, {0x06ff, 0x06ff, UC_Lo},
+	{0x0700, 0x070d, UC_Po}, {0x070f, 0x070f, UC_Cf}, {0x0710, 0x0710, UC_Lo},
+	{0x0711, 0x0711, UC_Mn}, {0x0712, 0x072f, UC_Lo}, {0x0730, 0x074a, UC_Mn},
+	{0x074d, 0x07a5, UC_Lo}, {0x07a6, 0x07b0, UC_Mn}, {0x07b1, 0x07b1, UC_Lo},
+	{0x07c0, 0x07c9, UC_Nd}, {0x07ca, 0x07ea, UC_Lo}, {0x07eb, 0x07f3, UC_Mn},
+	{0x07f4, 0x07f5, UC_Lm}, {0x07f6, 0x07f6, UC_So}, {0x07f7, 0x07f9, UC_Po},
+	{0x07fa, 0x07fa, UC_Lm}, {0x07fd, 0x07fd, UC_Mn}, {0x07fe, 0x07ff, UC_Sc},
+	{0x0800, 0x0815, UC_Lo}, {0x0816, 0x0819, UC_Mn}, {0x081a, 0x081a, UC_Lm},
+	{0x081b, 0x0823, UC_Mn}, {0x0824, 0x0824, UC_Lm}, {0x0825, 0x0827, UC_Mn},
+	{0x0828, 0x0828, UC_Lm}, {0x0829, 0x082d, UC_Mn}, {0x0830, 0x083e, UC_Po},
+	{0x0840, 0x0858, UC_Lo}, {0x0859, 0x085b, UC_Mn}, {0x085e, 0x085e, UC_Po},
+	{0x0860, 0x086a, UC_Lo}, {0x0870, 0x0887, UC_Lo}, {0x0888, 0x0888, UC_Sk},
+	{0x0889, 0x088e, UC_Lo}, {0x0890, 0x0891, UC_Cf}, {0x0898, 0x089f, UC_Mn},
+	{0x08a0, 0x08c8, UC_Lo}, {0x08c9, 0x08c9, UC_Lm}, {0x08ca, 0x08e1, UC_Mn},
+	{0x08e2, 0x08e2, UC_Cf}, {0x08e3, 0x0902, UC_Mn}, {0x0903, 0x0903, UC_Mc},
+	{0x0904, 0x0939, UC_Lo}, {0x093a, 0x093a, UC_Mn}, {0x093b, 0x093b, UC_Mc},
+	{0x093c, 0x093c, UC_Mn}, {0x093d, 0x093d, UC_Lo}, {0x093e, 0x0940, UC_Mc},
+	{0x0941, 0x0948, UC_Mn}, {0x0949, 0x094c, UC_Mc}, {0x094d, 0x094d, UC_Mn},
+	{0x094e, 0x094f, UC_Mc}, {0x0950, 0x0950, UC_Lo}, {0x0951, 0x0957, UC_Mn},
+	{0x0958, 0x0961, UC_Lo}, {0x0962, 0x0963, UC_Mn}, {0x0964, 0x0965, UC_Po},
+	{0x0966, 0x096f, UC_Nd}, {0x0970, 0x0970, UC_Po}, {0x0971, 0x0971, UC_Lm},
+	{0x0972, 0x0980, UC_Lo}, {0x0981, 0x0981, UC_Mn}, {0x0982, 0x0983, UC_Mc},
+	{0x0985, 0x098c, UC_Lo}, {0x098f, 0x0990, UC_Lo}, {0x0993, 0x09a8, UC_Lo},
+	{0x09aa, 0x09b0, UC_Lo}, {0x09b2, 0x09b2, UC_Lo}, {0x09b6, 0x09b9, UC_Lo},
+	{0x09bc, 0x09bc, UC_Mn}, {0x09bd, 0x09bd, UC_Lo}, {0x09be, 0x09c0, UC_Mc},
+	{0x09c1, 0x09c4, UC_Mn}, {0x09c7, 0x09c8, UC_Mc}, {0x09cb, 0x09cc, UC_Mc},
+	{0x09cd, 0x09cd, UC_Mn}, {0x09ce, 0x09ce, UC_Lo}, {0x09d7, 0x09d7, UC_Mc},
+	{0x09dc, 0x09dd, UC_Lo}, {0x09df, 0x09e1, UC_Lo}, {0x09e2, 0x09e3, UC_Mn},
+	{0x09e6, 0x09ef, UC_Nd}, {0x09f0, 0x09f1, UC_Lo}, {0x09f2, 0x09f3, UC_Sc},
+	{0x09f4, 0x09f9, UC_No}, {0x09fa, 0x09fa, UC_So}, {0x09fb, 0x09fb, UC_Sc},
+	{0x09fc, 0x09fc, UC_Lo}, {0x09fd, 0x09fd, UC_Po}, {0x09fe, 0x09fe, UC_Mn},
+	{0x0a01, 0x0a02, UC_Mn}, {0x0a03, 0x0a03, UC_Mc}, {0x0a05, 0x0a0a, UC_Lo},
+	{0x0a0f, 0x0a10, UC_Lo}, {0x0a13, 0x0a28, UC_Lo}, {0x0a2a, 0x0a30, UC_Lo},
+	{0x0a32, 0x0a33, UC_Lo}, {0x0a35, 0x0a36, UC_Lo}, {0x0a38, 0x0a39, UC_Lo},
+	{0x0a3c, 0x0a3c, UC_Mn}, {0x0a3e, 0x0a40, UC_Mc}, {0x0a41, 0x0a42, UC_Mn},
+	{0x0a47, 0x0a48, UC_Mn}, {0x0a4b, 0x0a4d, UC_Mn}, {0x0a51, 0x0a51, UC_Mn},
+	{0x0a59, 0x0a5c, UC_Lo}, {0x0a5e, 0x0a5e, UC_Lo}, {0x0a66, 0x0a6f, UC_Nd},
+	{0x0a70, 0x0a71, UC_Mn}, {0x0a72, 0x0a74, UC_Lo}, {0x0a75, 0x0a75, UC_Mn},
+	{0x0a76, 0x0a76, UC_Po}, {0x0a81, 0x0a82, UC_Mn}, {0x0a83, 0x0a83, UC_Mc},
+	{0x0a85, 0x0a8d, UC_Lo}, {0x0a8f, 0x0a91, UC_Lo}, {0x0a93, 0x0aa8, UC_Lo},
+	{0x0aaa, 0x0ab0, UC_Lo}, {0x0ab2, 0x0ab3, UC_Lo}, {0x0ab5, 0x0ab9, UC_Lo},
+	{0x0abc, 0x0abc, UC_Mn}, {0x0abd, 0x0abd, UC_Lo}, {0x0abe, 0x0ac0, UC_Mc},
+	{0x0ac1, 0x0ac5, UC_Mn}, {0x0ac7, 0x0ac8, UC_Mn}, {0x0ac9, 0x0ac9, UC_Mc},
+	{0x0acb, 0x0acc, UC_Mc}, {0x0acd, 0x0acd, UC_Mn}, {0x0ad0, 0x0ad0, UC_Lo},
+	{0x0ae0, 0x0ae1, UC_Lo}, {0x0ae2, 0x0ae3, UC_Mn}, {0x0ae6, 0x0aef, UC_Nd},
+	{0x0af0, 0x0af0, UC_Po}, {0x0af1, 0x0af1, UC_Sc}, {0x0af9, 0x0af9, UC_Lo},
+	{0x0afa, 0x0aff, UC_Mn}, {0x0b01, 0x0b01, UC_Mn}, {0x0b02, 0x0b03, UC_Mc},
+	{0x0b05, 0x0b0c, UC_Lo}, {0x0b0f, 0x0b10, UC_Lo}, {0x0b13, 0x0b28, UC_Lo},
+	{0x0b2a, 0x0b30, UC_Lo}, {0x0b32, 0x0b33, UC_Lo}, {0x0b35, 0x0b39, UC_Lo},
+	{0x0b3c, 0x0b3c, UC_Mn}, {0x0b3d, 0x0b3d, UC_Lo}, {0x0b3e, 0x0b3e, UC_Mc},
+	{0x0b3f, 0x0b3f, UC_Mn}, {0x0b40, 0x0b40, UC_Mc}, {0x0b41, 0x0b44, UC_Mn},
+	{0x0b47, 0x0b48, UC_Mc}, {0x0b4b, 0x0b4c, UC_Mc}, {0x0b4d, 0x0b4d, UC_Mn},
+	{0x0b55, 0x0b56, UC_Mn}, {0x0b57, 0x0b57, UC_Mc}, {0x0b5c, 0x0b5d, UC_Lo},
+	{0x0b5f, 0x0b61, UC_Lo}, {0x0b62, 0x0b63, UC_Mn}, {0x0b66, 0x0b6f, UC_Nd},
+	{0x0b70, 0x0b70, UC_So}, {0x0b71, 0x0b71, UC_Lo}, {0x0b72, 0x0b77, UC_No},
+	{0x0b82, 0x0b82, UC_Mn}, {0x0b83, 0x0b83, UC_Lo}, {0x0b85, 0x0b8a, UC_Lo},
+	{0x0b8e, 0x0b90, UC_Lo}, {0x0b92, 0x0b95, UC_Lo}, {0x0b99, 0x0b9a, UC_Lo},
+	{0x0b9c, 0x0b9c, UC_Lo}, {0x0b9e, 0x0b9f, UC_Lo}, {0x0ba3, 0x0ba4, UC_Lo},
+	{0x0ba8, 0x0baa, UC_Lo}, {0x0bae, 0x0bb9, UC_Lo}, {0x0bbe, 0x0bbf, UC_Mc},
+	{0x0bc0, 0x0bc0, UC_Mn}, {0x0bc1, 0x0bc2, UC_Mc}, {0x0bc6, 0x0bc8, UC_Mc},
+	{0x0bca, 0x0bcc, UC_Mc}, {0x0bcd, 0x0bcd, UC_Mn}, {0x0bd0, 0x0bd0, UC_Lo},
+	{0x0bd7, 0x0bd7, UC_Mc}, {0x0be6, 0x0bef, UC_Nd}, {0x0bf0, 0x0bf2, UC_No},
+	{0x0bf3, 0x0bf8, UC_So}, {0x0bf9, 0x0bf9, UC_Sc}, {0x0bfa, 0x0bfa, UC_So},
+	{0x0c00, 0x0c00, UC_Mn}, {0x0c01, 0x0c03, UC_Mc}, {0x0c04, 0x0c04, UC_Mn},
+	{0x0c05, 0x0c0c, UC_Lo}, {0x0c0e, 0x0c10, UC_Lo}, {0x0c12, 0x0c28, UC_Lo},
+	{0x0c2a, 0x0c39, UC_Lo}, {0x0c3c, 0x0c3c, UC_Mn}, {0x0c3d, 0x0c3d, UC_Lo},
+	{0x0c3e, 0x0c40, UC_Mn}, {0x0c41, 0x0c44, UC_Mc}, {0x0c46, 0x0c48, UC_Mn},
+	{0x0c4a, 0x0c4d, UC_Mn}, {0x0c55, 0x0c56, UC_Mn}, {0x0c58, 0x0c5a, UC_Lo},
+	{0x0c5d, 0x0c5d, UC_Lo}, {0x0c60, 0x0c61, UC_Lo}, {0x0c62, 0x0c63, UC_Mn},
+	{0x0c66, 0x0c6f, UC_Nd}, {0x0c77, 0x0c77, UC_Po}, {0x0c78, 0x0c7e, UC_No},
+	{0x0c7f, 0x0c7f, UC_So}, {0x0c80, 0x0c80, UC_Lo}, {0x0c81, 0x0c81, UC_Mn},
+	{0x0c82, 0x0c83, UC_Mc}, {0x0c84, 0x0c84, UC_Po}, {0x0c85, 0x0c8c, UC_Lo},
+	{0x0c8e, 0x0c90, UC_Lo}, {0x0c92, 0x0ca8, UC_Lo}, {0x0caa, 0x0cb3, UC_Lo},
+	{0x0cb5, 0x0cb9, UC_Lo}, {0x0cbc, 0x0cbc, UC_Mn}, {0x0cbd, 0x0cbd, UC_Lo},
+	{0x0cbe, 0x0cbe, UC_Mc}, {0x0cbf, 0x0cbf, UC_Mn}, {0x0cc0, 0x0cc4, UC_Mc},
+	{0x0cc6, 0x0cc6, UC_Mn}, {0x0cc7, 0x0cc8, UC_Mc}, {0x0cca, 0x0ccb, UC_Mc},
+	{0x0ccc, 0x0ccd, UC_Mn}, {0x0cd5, 0x0cd6, UC_Mc}, {0x0cdd, 0x0cde, UC_Lo},
+	{0x0ce0, 0x0ce1, UC_Lo}, {0x0ce2, 0x0ce3, UC_Mn}, {0x0ce6, 0x0cef, UC_Nd},
+	{0x0cf1, 0x0cf2, UC_Lo}, {0x0d00, 0x0d01, UC_Mn}, {0x0d02, 0x0d03, UC_Mc},
+	{0x0d04, 0x0d0c, UC_Lo}, {0x0d0e, 0x0d10, UC_Lo}, {0x0d12, 0x0d3a, UC_Lo},
+	{0x0d3b, 0x0d3c, UC_Mn}, {0x0d3d, 0x0d3d, UC_Lo}, {0x0d3e, 0x0d40, UC_Mc},
+	{0x0d41, 0x0d44, UC_Mn}, {0x0d46, 0x0d48, UC_Mc}, {0x0d4a, 0x0d4c, UC_Mc},
+	{0x0d4d, 0x0d4d, UC_Mn}, {0x0d4e, 0x0d4e, UC_Lo}, {0x0d4f, 0x0d4f, UC_So},
+	{0x0d54, 0x0d56, UC_Lo}, {0x0d57, 0x0d57, UC_Mc}, {0x0d58, 0x0d5e, UC_No},
+	{0x0d5f, 0x0d61, UC_Lo}, {0x0d62, 0x0d63, UC_Mn}, {0x0d66, 0x0d6f, UC_Nd},
+	{0x0d70, 0x0d78, UC_No}, {0x0d79, 0x0d79, UC_So}, {0x0d7a, 0x0d7f, UC_Lo},
+	{0x0d81, 0x0d81, UC_Mn}, {0x0d82, 0x0d83, UC_Mc}, {0x0d85, 0x0d96, UC_Lo},
+	{0x0d9a, 0x0db1, UC_Lo}, {0x0db3, 0x0dbb, UC_Lo}, {0x0dbd, 0x0dbd, UC_Lo},
+	{0x0dc0, 0x0dc6, UC_Lo}, {0x0dca, 0x0dca, UC_Mn}, {0x0dcf, 0x0dd1, UC_Mc},
+	{0x0dd2, 0x0dd4, UC_Mn}, {0x0dd6, 0x0dd6, UC_Mn}, {0x0dd8, 0x0ddf, UC_Mc},
+	{0x0de6, 0x0def, UC_Nd}, {0x0df2, 0x0df3, UC_Mc}, {0x0df4, 0x0df4, UC_Po},
+	{0x0e01, 0x0e30, UC_Lo}, {0x0e31, 0x0e31, UC_Mn}, {0x0e32, 0x0e33, UC_Lo},
+	{0x0e34, 0x0e3a, UC_Mn}, {0x0e3f, 0x0e3f, UC_Sc}, {0x0e40, 0x0e45, UC_Lo},
+	{0x0e46, 0x0e46, UC_Lm}, {0x0e47, 0x0e4e, UC_Mn}, {0x0e4f, 0x0e4f, UC_Po},
+	{0x0e50, 0x0e59, UC_Nd}, {0x0e5a, 0x0e5b, UC_Po}, {0x0e81, 0x0e82, UC_Lo},
+	{0x0e84, 0x0e84, UC_Lo}, {0x0e86, 0x0e8a, UC_Lo}, {0x0e8c, 0x0ea3, UC_Lo},
+	{0x0ea5, 0x0ea5, UC_Lo}, {0x0ea7, 0x0eb0, UC_Lo}, {0x0eb1, 0x0eb1, UC_Mn},
+	{0x0eb2, 0x0eb3, UC_Lo}, {0x0eb4, 0x0ebc, UC_Mn}, {0x0ebd, 0x0ebd, UC_Lo},
+	{0x0ec0, 0x0ec4, UC_Lo}, {0x0ec6, 0x0ec6, UC_Lm}, {0x0ec8, 0x0ecd, UC_Mn},
+	{0x0ed0, 0x0ed9, UC_Nd}, {0x0edc, 0x0edf, UC_Lo}, {0x0f00, 0x0f00, UC_Lo},
+	{0x0f01, 0x0f03, UC_So}, {0x0f04, 0x0f12, UC_Po}, {0x0f13, 0x0f13, UC_So},
+	{0x0f14, 0x0f14, UC_Po}, {0x0f15, 0x0f17, UC_So}, {0x0f18, 0x0f19, UC_Mn},
+	{0x0f1a, 0x0f1f, UC_So}, {0x0f20, 0x0f29, UC_Nd}, {0x0f2a, 0x0f33, UC_No},
+	{0x0f34, 0x0f34, UC_So}, {0x0f35, 0x0f35, UC_Mn}, {0x0f36, 0x0f36, UC_So},
+	{0x0f37, 0x0f37, UC_Mn}, {0x0f38, 0x0f38, UC_So}, {0x0f39, 0x0f39, UC_Mn},
+	{0x0f3a, 0x0f3a, UC_Ps}, {0x0f3b, 0x0f3b, UC_Pe}, {0x0f3c, 0x0f3c, UC_Ps},
+	{0x0f3d, 0x0f3d, UC_Pe}, {0x0f3e, 0x0f3f, UC_Mc}, {0x0f40, 0x0f47, UC_Lo},
+	{0x0f49, 0x0f6c, UC_Lo}, {0x0f71, 0x0f7e, UC_Mn}, {0x0f7f, 0x0f7f, UC_Mc},
+	{0x0f80, 0x0f84, UC_Mn}, {0x0f85, 0x0f85, UC_Po}, {0x0f86, 0x0f87, UC_Mn},
+	{0x0f88, 0x0f8c, UC_Lo}, {0x0f8d, 0x0f97, UC_Mn}, {0x0f99, 0x0fbc, UC_Mn},
+	{0x0fbe, 0x0fc5, UC_So}, {0x0fc6, 0x0fc6, UC_Mn}, {0x0fc7, 0x0fcc, UC_So},
+	{0x0fce, 0x0fcf, UC_So}, {0x0fd0, 0x0fd4, UC_Po}, {0x0fd5, 0x0fd8, UC_So},
+	{0x0fd9, 0x0fda, UC_Po}, {0x1000, 0x102a, UC_Lo}, {0x102b, 0x102c, UC_Mc},
+	{0x102d, 0x1030, UC_Mn}, {0x1031, 0x1031, UC_Mc}, {0x1032, 0x1037, UC_Mn},
+	{0x1038, 0x1038, UC_Mc}, {0x1039, 0x103a, UC_Mn}, {0x103b, 0x103c, UC_Mc},
+	{0x103d, 0x103e, UC_Mn}, {0x103f, 0x103f, UC_Lo}, {0x1040, 0x1049, UC_Nd},
+	{0x104a, 0x104f, UC_Po}, {0x1050, 0x1055, UC_Lo}, {0x1056, 0x1057, UC_Mc},
+	{0x1058, 0x1059, UC_Mn}, {0x105a, 0x105d, UC_Lo}, {0x105e, 0x1060, UC_Mn},
+	{0x1061, 0x1061, UC_Lo}, {0x1062, 0x1064, UC_Mc}, {0x1065, 0x1066, UC_Lo},
+	{0x1067, 0x106d, UC_Mc}, {0x106e, 0x1070, UC_Lo}, {0x1071, 0x1074, UC_Mn},
+	{0x1075, 0x1081, UC_Lo}, {0x1082, 0x1082, UC_Mn}, {0x1083, 0x1084, UC_Mc},
+	{0x1085, 0x1086, UC_Mn}, {0x1087, 0x108c, UC_Mc}, {0x108d, 0x108d, UC_Mn},
+	{0x108e, 0x108e, UC_Lo}, {0x108f, 0x108f, UC_Mc}, {0x1090, 0x1099, UC_Nd},
+	{0x109a, 0x109c, UC_Mc}, {0x109d, 0x109d, UC_Mn}, {0x109e, 0x109f, UC_So},
+	{0x10a0, 0x10c5, UC_Lu}, {0x10c7, 0x10c7, UC_Lu}, {0x10cd, 0x10cd, UC_Lu},
+	{0x10d0, 0x10fa, UC_Ll}, {0x10fb, 0x10fb, UC_Po}, {0x10fc, 0x10fc, UC_Lm},
+	{0x10fd, 0x10ff, UC_Ll}, {0x1100, 0x1248, UC_Lo}, {0x124a, 0x124d, UC_Lo},
+	{0x1250, 0x1256, UC_Lo}, {0x1258, 0x1258, UC_Lo}, {0x125a, 0x125d, UC_Lo},
+	{0x1260, 0x1288, UC_Lo}, {0x128a, 0x128d, UC_Lo}, {0x1290, 0x12b0, UC_Lo},
+	{0x12b2, 0x12b5, UC_Lo}, {0x12b8, 0x12be, UC_Lo}, {0x12c0, 0x12c0, UC_Lo},
+	{0x12c2, 0x12c5, UC_Lo}, {0x12c8, 0x12d6, UC_Lo}, {0x12d8, 0x1310, UC_Lo},
+	{0x1312, 0x1315, UC_Lo}, {0x1318, 0x135a, UC_Lo}, {0x135d, 0x135f, UC_Mn},
+	{0x1360, 0x1368, UC_Po}, {0x1369, 0x137c, UC_No}, {0x1380, 0x138f, UC_Lo},
+	{0x1390, 0x1399, UC_So}, {0x13a0, 0x13f5, UC_Lu}, {0x13f8, 0x13fd, UC_Ll},
+	{0x1400, 0x1400, UC_Pd}, {0x1401, 0x166c, UC_Lo}, {0x166d, 0x166d, UC_So},
+	{0x166e, 0x166e, UC_Po}, {0x166f, 0x167f, UC_Lo}, {0x1680, 0x1680, UC_Zs},
+	{0x1681, 0x169a, UC_Lo}, {0x169b, 0x169b, UC_Ps}, {0x169c, 0x169c, UC_Pe},
+	{0x16a0, 0x16ea, UC_Lo}, {0x16eb, 0x16ed, UC_Po}, {0x16ee, 0x16f0, UC_Nl},
+	{0x16f1, 0x16f8, UC_Lo}, {0x1700, 0x1711, UC_Lo}, {0x1712, 0x1714, UC_Mn},
+	{0x1715, 0x1715, UC_Mc}, {0x171f, 0x1731, UC_Lo}, {0x1732, 0x1733, UC_Mn},
+	{0x1734, 0x1734, UC_Mc}, {0x1735, 0x1736, UC_Po}, {0x1740, 0x1751, UC_Lo},
+	{0x1752, 0x1753, UC_Mn}, {0x1760, 0x176c, UC_Lo}, {0x176e, 0x1770, UC_Lo},
+	{0x1772, 0x1773, UC_Mn}, {0x1780, 0x17b3, UC_Lo}, {0x17b4, 0x17b5, UC_Mn},
+	{0x17b6, 0x17b6, UC_Mc}, {0x17b7, 0x17bd, UC_Mn}, {0x17be, 0x17c5, UC_Mc},
+	{0x17c6, 0x17c6, UC_Mn}, {0x17c7, 0x17c8, UC_Mc}, {0x17c9, 0x17d3, UC_Mn},
+	{0x17d4, 0x17d6, UC_Po}, {0x17d7, 0x17d7, UC_Lm}, {0x17d8, 0x17da, UC_Po},
+	{0x17db, 0x17db, UC_Sc}, {0x17dc, 0x17dc, UC_Lo}, {0x17dd, 0x17dd, UC_Mn},
+	{0x17e0, 0x17e9, UC_Nd}, {0x17f0, 0x17f9, UC_No}, {0x1800, 0x1805, UC_Po},
+	{0x1806, 0x1806, UC_Pd}, {0x1807, 0x180a, UC_Po}, {0x180b, 0x180d, UC_Mn},
+	{0x180e, 0x180e, UC_Cf}, {0x180f, 0x180f, UC_Mn}, {0x1810, 0x1819, UC_Nd},
+	{0x1820, 0x1842, UC_Lo}, {0x1843, 0x1843, UC_Lm}, {0x1844, 0x1878, UC_Lo},
+	{0x1880, 0x1884, UC_Lo}, {0x1885, 0x1886, UC_Mn}, {0x1887, 0x18a8, UC_Lo},
+	{0x18a9, 0x18a9, UC_Mn}, {0x18aa, 0x18aa, UC_Lo}, {0x18b0, 0x18f5, UC_Lo},
+	{0x1900, 0x191e, UC_Lo}, {0x1920, 0x1922, UC_Mn}, {0x1923, 0x1926, UC_Mc},
+	{0x1927, 0x1928, UC_Mn}, {0x1929, 0x192b, UC_Mc}, {0x1930, 0x1931, UC_Mc},
+	{0x1932, 0x1932, UC_Mn}, {0x1933, 0x1938, UC_Mc}, {0x1939, 0x193b, UC_Mn},
+	{0x1940, 0x1940, UC_So}, {0x1944, 0x1945, UC_Po}, {0x1946, 0x194f, UC_Nd},
+	{0x1950, 0x196d, UC_Lo}, {0x1970, 0x1974, UC_Lo}, {0x1980, 0x19ab, UC_Lo},
+	{0x19b0, 0x19c9, UC_Lo}, {0x19d0, 0x19d9, UC_Nd}, {0x19da, 0x19da, UC_No},
+	{0x19de, 0x19ff, UC_So}, {0x1a00, 0x1a16, UC_Lo}, {0x1a17, 0x1a18, UC_Mn},
+	{0x1a19, 0x1a1a, UC_Mc}, {0x1a1b, 0x1a1b, UC_Mn}, {0x1a1e, 0x1a1f, UC_Po},
+	{0x1a20, 0x1a54, UC_Lo}, {0x1a55, 0x1a55, UC_Mc}, {0x1a56, 0x1a56, UC_Mn},
+	{0x1a57, 0x1a57, UC_Mc}, {0x1a58, 0x1a5e, UC_Mn}, {0x1a60, 0x1a60, UC_Mn},
+	{0x1a61, 0x1a61, UC_Mc}, {0x1a62, 0x1a62, UC_Mn}, {0x1a63, 0x1a64, UC_Mc},
+	{0x1a65, 0x1a6c, UC_Mn}, {0x1a6d, 0x1a72, UC_Mc}, {0x1a73, 0x1a7c, UC_Mn},
+	{0x1a7f, 0x1a7f, UC_Mn}, {0x1a80, 0x1a89, UC_Nd}, {0x1a90, 0x1a99, UC_Nd},
+	{0x1aa0, 0x1aa6, UC_Po}, {0x1aa7, 0x1aa7, UC_Lm}, {0x1aa8, 0x1aad, UC_Po},
+	{0x1ab0, 0x1abd, UC_Mn}, {0x1abe, 0x1abe, UC_Me}, {0x1abf, 0x1ace, UC_Mn},
+	{0x1b00, 0x1b03, UC_Mn}, {0x1b04, 0x1b04, UC_Mc}, {0x1b05, 0x1b33, UC_Lo},
+	{0x1b34, 0x1b34, UC_Mn}, {0x1b35, 0x1b35, UC_Mc}, {0x1b36, 0x1b3a, UC_Mn},
+	{0x1b3b, 0x1b3b, UC_Mc}, {0x1b3c, 0x1b3c, UC_Mn}, {0x1b3d, 0x1b41, UC_Mc},
+	{0x1b42, 0x1b42, UC_Mn}, {0x1b43, 0x1b44, UC_Mc}, {0x1b45, 0x1b4c, UC_Lo},
+	{0x1b50, 0x1b59, UC_Nd}, {0x1b5a, 0x1b60, UC_Po}, {0x1b61, 0x1b6a, UC_So},
+	{0x1b6b, 0x1b73, UC_Mn}, {0x1b74, 0x1b7c, UC_So}, {0x1b7d, 0x1b7e, UC_Po},
+	{0x1b80, 0x1b81, UC_Mn}, {0x1b82, 0x1b82, UC_Mc}, {0x1b83, 0x1ba0, UC_Lo},
+	{0x1ba1, 0x1ba1, UC_Mc}, {0x1ba2, 0x1ba5, UC_Mn}, {0x1ba6, 0x1ba7, UC_Mc},
+	{0x1ba8, 0x1ba9, UC_Mn}, {0x1baa, 0x1baa, UC_Mc}, {0x1bab, 0x1bad, UC_Mn},
+	{0x1bae, 0x1baf, UC_Lo}, {0x1bb0, 0x1bb9, UC_Nd}, {0x1bba, 0x1be5, UC_Lo},
+	{0x1be6, 0x1be6, UC_Mn}, {0x1be7, 0x1be7, UC_Mc}, {0x1be8, 0x1be9, UC_Mn},
+	{0x1bea, 0x1bec, UC_Mc}, {0x1bed, 0x1bed, UC_Mn}, {0x1bee, 0x1bee, UC_Mc},
+	{0x1bef, 0x1bf1, UC_Mn}, {0x1bf2, 0x1bf3, UC_Mc}, {0x1bfc, 0x1bff, UC_Po},
+	{0x1c00, 0x1c23, UC_Lo}, {0x1c24, 0x1c2b, UC_Mc}, {0x1c2c, 0x1c33, UC_Mn},
+	{0x1c34, 0x1c35, UC_Mc}, {0x1c36, 0x1c37, UC_Mn}, {0x1c3b, 0x1c3f, UC_Po},
+	{0x1c40, 0x1c49, UC_Nd}, {0x1c4d, 0x1c4f, UC_Lo}, {0x1c50, 0x1c59, UC_Nd},
+	{0x1c5a, 0x1c77, UC_Lo}, {0x1c78, 0x1c7d, UC_Lm}, {0x1c7e, 0x1c7f, UC_Po},
+	{0x1c80, 0x1c88, UC_Ll}, {0x1c90, 0x1cba, UC_Lu}, {0x1cbd, 0x1cbf, UC_Lu},
+	{0x1cc0, 0x1cc7, UC_Po}, {0x1cd0, 0x1cd2, UC_Mn}, {0x1cd3, 0x1cd3, UC_Po},
+	{0x1cd4, 0x1ce0, UC_Mn}, {0x1ce1, 0x1ce1, UC_Mc}, {0x1ce2, 0x1ce8, UC_Mn},
+	{0x1ce9, 0x1cec, UC_Lo}, {0x1ced, 0x1ced, UC_Mn}, {0x1cee, 0x1cf3, UC_Lo},
+	{0x1cf4, 0x1cf4, UC_Mn}, {0x1cf5, 0x1cf6, UC_Lo}, {0x1cf7, 0x1cf7, UC_Mc},
+	{0x1cf8, 0x1cf9, UC_Mn}, {0x1cfa, 0x1cfa, UC_Lo}, {0x1d00, 0x1d2b, UC_Ll},
+	{0x1d2c, 0x1d6a, UC_Lm}, {0x1d6b, 0x1d77, UC_Ll}, {0x1d78, 0x1d78, UC_Lm},
+	{0x1d79, 0x1d9a, UC_Ll}, {0x1d9b, 0x1dbf, UC_Lm}, {0x1dc0, 0x1dff, UC_Mn},
+	{0x1e00, 0x1e00, UC_Lu}, {0x1e01, 0x1e01, UC_Ll}, {0x1e02, 0x1e02, UC_Lu},
+	{0x1e03, 0x1e03, UC_Ll}, {0x1e04, 0x1e04, UC_Lu}, {0x1e05, 0x1e05, UC_Ll},
+	{0x1e06, 0x1e06, UC_Lu}, {0x1e07, 0x1e07, UC_Ll}, {0x1e08, 0x1e08, UC_Lu},
+	{0x1e09, 0x1e09, UC_Ll}, {0x1e0a, 0x1e0a, UC_Lu}, {0x1e0b, 0x1e0b, UC_Ll},
+	{0x1e0c, 0x1e0c, UC_Lu}, {0x1e0d, 0x1e0d, UC_Ll}, {0x1e0e, 0x1e0e, UC_Lu},
+	{0x1e0f, 0x1e0f, UC_Ll}, {0x1e10, 0x1e10, UC_Lu}, {0x1e11, 0x1e11, UC_Ll},
+	{0x1e12, 0x1e12, UC_Lu}, {0x1e13, 0x1e13, UC_Ll}, {0x1e14, 0x1e14, UC_Lu},
+	{0x1e15, 0x1e15, UC_Ll}, {0x1e16, 0x1e16, UC_Lu}, {0x1e17, 0x1e17, UC_Ll},
+	{0x1e18, 0x1e18, UC_Lu}, {0x1e19, 0x1e19, UC_Ll}, {0x1e1a, 0x1e1a, UC_Lu},
+	{0x1e1b, 0x1e1b, UC_Ll}, {0x1e1c, 0x1e1c, UC_Lu}, {0x1e1d, 0x1e1d, UC_Ll},
+	{0x1e1e, 0x1e1e, UC_Lu}, {0x1e1f, 0x1e1f, UC_Ll}, {0x1e20, 0x1e20, UC_Lu},
+	{0x1e21, 0x1e21, UC_Ll}, {0x1e22, 0x1e22, UC_Lu}, {0x1e23, 0x1e23, UC_Ll},
+	{0x1e24, 0x1e24, UC_Lu}, {0x1e25, 0x1e25, UC_Ll}, {0x1e26, 0x1e26, UC_Lu},
+	{0x1e27, 0x1e27, UC_Ll}, {0x1e28, 0x1e28, UC_Lu}, {0x1e29, 0x1e29, UC_Ll},
+	{0x1e2a, 0x1e2a, UC_Lu}, {0x1e2b, 0x1e2b, UC_Ll}, {0x1e2c, 0x1e2c, UC_Lu},
+	{0x1e2d, 0x1e2d, UC_Ll}, {0x1e2e, 0x1e2e, UC_Lu}, {0x1e2f, 0x1e2f, UC_Ll},
+	{0x1e30, 0x1e30, UC_Lu}, {0x1e31, 0x1e31, UC_Ll}, {0x1e32, 0x1e32, UC_Lu},
+	{0x1e33, 0x1e33, UC_Ll}, {0x1e34, 0x1e34, UC_Lu}, {0x1e35, 0x1e35, UC_Ll},
+	{0x1e36, 0x1e36, UC_Lu}, {0x1e37, 0x1e37, UC_Ll}, {0x1e38, 0x1e38, UC_Lu},
+	{0x1e39, 0x1e39, UC_Ll}, {0x1e3a, 0x1e3a, UC_Lu}, {0x1e3b, 0x1e3b, UC_Ll},
+	{0x1e3c, 0x1e3c, UC_Lu}, {0x1e3d, 0x1e3d, UC_Ll}, {0x1e3e, 0x1e3e, UC_Lu},
+	{0x1e3f, 0x1e3f, UC_Ll}, {0x1e40, 0x1e40, UC_Lu}, {0x1e41, 0x1e41, UC_Ll},
+	{0x1e42, 0x1e42, UC_Lu}, {0x1e43, 0x1e43, UC_Ll}, {0x1e44, 0x1e44, UC_Lu},
+	{0x1e45, 0x1e45, UC_Ll}, {0x1e46, 0x1e46, UC_Lu}, {0x1e47, 0x1e47, UC_Ll},
+	{0x1e48, 0x1e48, UC_Lu}, {0x1e49, 0x1e49, UC_Ll}, {0x1e4a, 0x1e4a, UC_Lu},
+	{0x1e4b, 0x1e4b, UC_Ll}, {0x1e4c, 0x1e4c, UC_Lu}, {0x1e4d, 0x1e4d, UC_Ll},
+	{0x1e4e, 0x1e4e, UC_Lu}, {0x1e4f, 0x1e4f, UC_Ll}, {0x1e50, 0x1e50, UC_Lu},
+	{0x1e51, 0x1e51, UC_Ll}, {0x1e52, 0x1e52, UC_Lu}, {0x1e53, 0x1e53, UC_Ll},
+	{0x1e54, 0x1e54, UC_Lu}, {0x1e55, 0x1e55, UC_Ll}, {0x1e56, 0x1e56, UC_Lu},
+	{0x1e57, 0x1e57, UC_Ll}, {0x1e58, 0x1e58, UC_Lu}, {0x1e59, 0x1e59, UC_Ll},
+	{0x1e5a, 0x1e5a, UC_Lu}, {0x1e5b, 0x1e5b, UC_Ll}, {0x1e5c, 0x1e5c, UC_Lu},
+	{0x1e5d, 0x1e5d, UC_Ll}, {0x1e5e, 0x1e5e, UC_Lu}, {0x1e5f, 0x1e5f, UC_Ll},
+	{0x1e60, 0x1e60, UC_Lu}, {0x1e61, 0x1e61, UC_Ll}, {0x1e62, 0x1e62, UC_Lu},
+	{0x1e63, 0x1e63, UC_Ll}, {0x1e64, 0x1e64, UC_Lu}, {0x1e65, 0x1e65, UC_Ll},
+	{0x1e66, 0x1e66, UC_Lu}, {0x1e67, 0x1e67, UC_Ll}, {0x1e68, 0x1e68, UC_Lu},
+	{0x1e69, 0x1e69, UC_Ll}, {0x1e6a, 0x1e6a, UC_Lu}, {0x1e6b, 0x1e6b, UC_Ll},
+	{0x1e6c, 0x1e6c, UC_Lu}, {0x1e6d, 0x1e6d, UC_Ll}, {0x1e6e, 0x1e6e, UC_Lu},
+	{0x1e6f, 0x1e6f, UC_Ll}, {0x1e70, 0x1e70, UC_Lu}, {0x1e71, 0x1e71, UC_Ll},
+	{0x1e72, 0x1e72, UC_Lu}, {0x1e73, 0x1e73, UC_Ll}, {0x1e74, 0x1e74, UC_Lu},
+	{0x1e75, 0x1e75, UC_Ll}, {0x1e76, 0x1e76, UC_Lu}, {0x1e77, 0x1e77, UC_Ll},
+	{0x1e78, 0x1e78, UC_Lu}, {0x1e79, 0x1e79, UC_Ll}, {0x1e7a, 0x1e7a, UC_Lu},
+	{0x1e7b, 0x1e7b, UC_Ll}, {0x1e7c, 0x1e7c, UC_Lu}, {0x1e7d, 0x1e7d, UC_Ll},
+	{0x1e7e, 0x1e7e, UC_Lu}, {0x1e7f, 0x1e7f, UC_Ll}, {0x1e80, 0x1e80, UC_Lu},
+	{0x1e81, 0x1e81, UC_Ll}, {0x1e82, 0x1e82, UC_Lu}, {0x1e83, 0x1e83, UC_Ll},
+	{0x1e84, 0x1e84, UC_Lu}, {0x1e85, 0x1e85, UC_Ll}, {0x1e86, 0x1e86, UC_Lu},
+	{0x1e87, 0x1e87, UC_Ll}, {0x1e88, 0x1e88, UC_Lu}, {0x1e89, 0x1e89, UC_Ll},
+	{0x1e8a, 0x1e8a, UC_Lu}, {0x1e8b, 0x1e8b, UC_Ll}, {0x1e8c, 0x1e8c, UC_Lu},
+	{0x1e8d, 0x1e8d, UC_Ll}, {0x1e8e, 0x1e8e, UC_Lu}, {0x1e8f, 0x1e8f, UC_Ll},
+	{0x1e90, 0x1e90, UC_Lu}, {0x1e91, 0x1e91, UC_Ll}, {0x1e92, 0x1e92, UC_Lu},
+	{0x1e93, 0x1e93, UC_Ll}, {0x1e94, 0x1e94, UC_Lu}, {0x1e95, 0x1e9d, UC_Ll},
+	{0x1e9e, 0x1e9e, UC_Lu}, {0x1e9f, 0x1e9f, UC_Ll}, {0x1ea0, 0x1ea0, UC_Lu},
+	{0x1ea1, 0x1ea1, UC_Ll}, {0x1ea2, 0x1ea2, UC_Lu}, {0x1ea3, 0x1ea3, UC_Ll},
+	{0x1ea4, 0x1ea4, UC_Lu}, {0x1ea5, 0x1ea5, UC_Ll}, {0x1ea6, 0x1ea6, UC_Lu},
+	{0x1ea7, 0x1ea7, UC_Ll}, {0x1ea8, 0x1ea8, UC_Lu}, {0x1ea9, 0x1ea9, UC_Ll},
+	{0x1eaa, 0x1eaa, UC_Lu}, {0x1eab, 0x1eab, UC_Ll}, {0x1eac, 0x1eac, UC_Lu},
+	{0x1ead, 0x1ead, UC_Ll}, {0x1eae, 0x1eae, UC_Lu}, {0x1eaf, 0x1eaf, UC_Ll},
+	{0x1eb0, 0x1eb0, UC_Lu}, {0x1eb1, 0x1eb1, UC_Ll}, {0x1eb2, 0x1eb2, UC_Lu},
+	{0x1eb3, 0x1eb3, UC_Ll}, {0x1eb4, 0x1eb4, UC_Lu}, {0x1eb5, 0x1eb5, UC_Ll},
+	{0x1eb6, 0x1eb6, UC_Lu}, {0x1eb7, 0x1eb7, UC_Ll}, {0x1eb8, 0x1eb8, UC_Lu},
+	{0x1eb9, 0x1eb9, UC_Ll}, {0x1eba, 0x1eba, UC_Lu}, {0x1ebb, 0x1ebb, UC_Ll},
+	{0x1ebc, 0x1ebc, UC_Lu}, {0x1ebd, 0x1ebd, UC_Ll}, {0x1ebe, 0x1ebe, UC_Lu},
+	{0x1ebf, 0x1ebf, UC_Ll}, {0x1ec0, 0x1ec0, UC_Lu}, {0x1ec1, 0x1ec1, UC_Ll},
+	{0x1ec2, 0x1ec2, UC_Lu}, {0x1ec3, 0x1ec3, UC_Ll}, {0x1ec4, 0x1ec4, UC_Lu},
+	{0x1ec5, 0x1ec5, UC_Ll}, {0x1ec6, 0x1ec6, UC_Lu}, {0x1ec7, 0x1ec7, UC_Ll},
+	{0x1ec8, 0x1ec8, UC_Lu}, {0x1ec9, 0x1ec9, UC_Ll}, {0x1eca, 0x1eca, UC_Lu},
+	{0x1ecb, 0x1ecb, UC_Ll}, {0x1ecc, 0x1ecc, UC_Lu}, {0x1ecd, 0x1ecd, UC_Ll},
+	{0x1ece, 0x1ece, UC_Lu}, {0x1ecf, 0x1ecf, UC_Ll}, {0x1ed0, 0x1ed0, UC_Lu},
+	{0x1ed1, 0x1ed1, UC_Ll}, {0x1ed2, 0x1ed2, UC_Lu}, {0x1ed3, 0x1ed3, UC_Ll},
+	{0x1ed4, 0x1ed4, UC_Lu}, {0x1ed5, 0x1ed5, UC_Ll}, {0x1ed6, 0x1ed6, UC_Lu},
+	{0x1ed7, 0x1ed7, UC_Ll}, {0x1ed8, 0x1ed8, UC_Lu}, {0x1ed9, 0x1ed9, UC_Ll},
+	{0x1eda, 0x1eda, UC_Lu}, {0x1edb, 0x1edb, UC_Ll}, {0x1edc, 0x1edc, UC_Lu},
+	{0x1edd, 0x1edd, UC_Ll}, {0x1ede, 0x1ede, UC_Lu}, {0x1edf, 0x1edf, UC_Ll},
+	{0x1ee0, 0x1ee0, UC_Lu}, {0x1ee1, 0x1ee1, UC_Ll}, {0x1ee2, 0x1ee2, UC_Lu},
+	{0x1ee3, 0x1ee3, UC_Ll}, {0x1ee4, 0x1ee4, UC_Lu}, {0x1ee5, 0x1ee5, UC_Ll},
+	{0x1ee6, 0x1ee6, UC_Lu}, {0x1ee7, 0x1ee7, UC_Ll}, {0x1ee8, 0x1ee8, UC_Lu},
+	{0x1ee9, 0x1ee9, UC_Ll}, {0x1eea, 0x1eea, UC_Lu}, {0x1eeb, 0x1eeb, UC_Ll},
+	{0x1eec, 0x1eec, UC_Lu}, {0x1eed, 0x1eed, UC_Ll}, {0x1eee, 0x1eee, UC_Lu},
+	{0x1eef, 0x1eef, UC_Ll}, {0x1ef0, 0x1ef0, UC_Lu}, {0x1ef1, 0x1ef1, UC_Ll},
+	{0x1ef2, 0x1ef2, UC_Lu}, {0x1ef3, 0x1ef3, UC_Ll}, {0x1ef4, 0x1ef4, UC_Lu},
+	{0x1ef5, 0x1ef5, UC_Ll}, {0x1ef6, 0x1ef6, UC_Lu}, {0x1ef7, 0x1ef7, UC_Ll},
+	{0x1ef8, 0x1ef8, UC_Lu}, {0x1ef9, 0x1ef9, UC_Ll}, {0x1efa, 0x1efa, UC_Lu},
+	{0x1efb, 0x1efb, UC_Ll}, {0x1efc, 0x1efc, UC_Lu}, {0x1efd, 0x1efd, UC_Ll},
+	{0x1efe, 0x1efe, UC_Lu}, {0x1eff, 0x1f07, UC_Ll}, {0x1f08, 0x1f0f, UC_Lu},
+	{0x1f10, 0x1f15, UC_Ll}, {0x1f18, 0x1f1d, UC_Lu}, {0x1f20, 0x1f27, UC_Ll},
+	{0x1f28, 0x1f2f, UC_Lu}, {0x1f30, 0x1f37, UC_Ll}, {0x1f38, 0x1f3f, UC_Lu},
+	{0x1f40, 0x1f45, UC_Ll}, {0x1f48, 0x1f4d, UC_Lu}, {0x1f50, 0x1f57, UC_Ll},
+	{0x1f59, 0x1f59, UC_Lu}, {0x1f5b, 0x1f5b, UC_Lu}, {0x1f5d, 0x1f5d, UC_Lu},
+	{0x1f5f, 0x1f5f, UC_Lu}, {0x1f60, 0x1f67, UC_Ll}, {0x1f68, 0x1f6f, UC_Lu},
+	{0x1f70, 0x1f7d, UC_Ll}, {0x1f80, 0x1f87, UC_Ll}, {0x1f88, 0x1f8f, UC_Lt},
+	{0x1f90, 0x1f97, UC_Ll}, {0x1f98, 0x1f9f, UC_Lt}, {0x1fa0, 0x1fa7, UC_Ll},
+	{0x1fa8, 0x1faf, UC_Lt}, {0x1fb0, 0x1fb4, UC_Ll}, {0x1fb6, 0x1fb7, UC_Ll},
+	{0x1fb8, 0x1fbb, UC_Lu}, {0x1fbc, 0x1fbc, UC_Lt}, {0x1fbd, 0x1fbd, UC_Sk},
+	{0x1fbe, 0x1fbe, UC_Ll}, {0x1fbf, 0x1fc1, UC_Sk}, {0x1fc2, 0x1fc4, UC_Ll},
+	{0x1fc6, 0x1fc7, UC_Ll}, {0x1fc8, 0x1fcb, UC_Lu}, {0x1fcc, 0x1fcc, UC_Lt},
+	{0x1fcd, 0x1fcf, UC_Sk}, {0x1fd0, 0x1fd3, UC_Ll}, {0x1fd6, 0x1fd7, UC_Ll},
+	{0x1fd8, 0x1fdb, UC_Lu}, {0x1fdd, 0x1fdf, UC_Sk}, {0x1fe0, 0x1fe7, UC_Ll},
+	{0x1fe8, 0x1fec, UC_Lu}, {0x1fed, 0x1fef, UC_Sk}, {0x1ff2, 0x1ff4, UC_Ll},
+	{0x1ff6, 0x1ff7, UC_Ll}, {0x1ff8, 0x1ffb, UC_Lu}, {0x1ffc, 0x1ffc, UC_Lt},
+	{0x1ffd, 0x1ffe, UC_Sk}, {0x2000, 0x200a, UC_Zs}, {0x200b, 0x200f, UC_Cf},
+	{0x2010, 0x2015, UC_Pd}, {0x2016, 0x2017, UC_Po}, {0x2018, 0x2018, UC_Pi},
+	{0x2019, 0x2019, UC_Pf}, {0x201a, 0x201a, UC_Ps}, {0x201b, 0x201c, UC_Pi},
+	{0x201d, 0x201d, UC_Pf}, {0x201e, 0x201e, UC_Ps}, {0x201f, 0x201f, UC_Pi},
+	{0x2020, 0x2027, UC_Po}, {0x2028, 0x2028, UC_Zl}, {0x2029, 0x2029, UC_Zp},
+	{0x202a, 0x202e, UC_Cf}, {0x202f, 0x202f, UC_Zs}, {0x2030, 0x2038, UC_Po},
+	{0x2039, 0x2039, UC_Pi}, {0x203a, 0x203a, UC_Pf}, {0x203b, 0x203e, UC_Po},
+	{0x203f, 0x2040, UC_Pc}, {0x2041, 0x2043, UC_Po}, {0x2044, 0x2044, UC_Sm},
+	{0x2045, 0x2045, UC_Ps}, {0x2046, 0x2046, UC_Pe}, {0x2047, 0x2051, UC_Po},
+	{0x2052, 0x2052, UC_Sm}, {0x2053, 0x2053, UC_Po}, {0x2054, 0x2054, UC_Pc},
+	{0x2055, 0x205e, UC_Po}, {0x205f, 0x205f, UC_Zs}, {0x2060, 0x2064, UC_Cf},
+	{0x2066, 0x206f, UC_Cf}, {0x2070, 0x2070, UC_No}, {0x2071, 0x2071, UC_Lm},
+	{0x2074, 0x2079, UC_No}, {0x207a, 0x207c, UC_Sm}, {0x207d, 0x207d, UC_Ps},
+	{0x207e, 0x207e, UC_Pe}, {0x207f, 0x207f, UC_Lm}, {0x2080, 0x2089, UC_No},
+	{0x208a, 0x208c, UC_Sm}, {0x208d, 0x208d, UC_Ps}, {0x208e, 0x208e, UC_Pe},
+	{0x2090, 0x209c, UC_Lm}, {0x20a0, 0x20c0, UC_Sc}, {0x20d0, 0x20dc, UC_Mn},
+	{0x20dd, 0x20e0, UC_Me}, {0x20e1, 0x20e1, UC_Mn}, {0x20e2, 0x20e4, UC_Me},
+	{0x20e5, 0x20f0, UC_Mn}, {0x2100, 0x2101, UC_So}, {0x2102, 0x2102, UC_Lu},
+	{0x2103, 0x2106, UC_So}, {0x2107, 0x2107, UC_Lu}, {0x2108, 0x2109, UC_So},
+	{0x210a, 0x210a, UC_Ll}, {0x210b, 0x210d, UC_Lu}, {0x210e, 0x210f, UC_Ll},
+	{0x2110, 0x2112, UC_Lu}, {0x2113, 0x2113, UC_Ll}, {0x2114, 0x2114, UC_So},
+	{0x2115, 0x2115, UC_Lu}, {0x2116, 0x2117, UC_So}, {0x2118, 0x2118, UC_Sm},
+	{0x2119, 0x211d, UC_Lu}, {0x211e, 0x2123, UC_So}, {0x2124, 0x2124, UC_Lu},
+	{0x2125, 0x2125, UC_So}, {0x2126, 0x2126, UC_Lu}, {0x2127, 0x2127, UC_So},
+	{0x2128, 0x2128, UC_Lu}, {0x2129, 0x2129, UC_So}, {0x212a, 0x212d, UC_Lu},
+	{0x212e, 0x212e, UC_So}, {0x212f, 0x212f, UC_Ll}, {0x2130, 0x2133, UC_Lu},
+	{0x2134, 0x2134, UC_Ll}, {0x2135, 0x2138, UC_Lo}, {0x2139, 0x2139, UC_Ll},
+	{0x213a, 0x213b, UC_So}, {0x213c, 0x213d, UC_Ll}, {0x213e, 0x213f, UC_Lu},
+	{0x2140, 0x2144, UC_Sm}, {0x2145, 0x2145, UC_Lu}, {0x2146, 0x2149, UC_Ll},
+	{0x214a, 0x214a, UC_So}, {0x214b, 0x214b, UC_Sm}, {0x214c, 0x214d, UC_So},
+	{0x214e, 0x214e, UC_Ll}, {0x214f, 0x214f, UC_So}, {0x2150, 0x215f, UC_No},
+	{0x2160, 0x2182, UC_Nl}, {0x2183, 0x2183, UC_Lu}, {0x2184, 0x2184, UC_Ll},
+	{0x2185, 0x2188, UC_Nl}, {0x2189, 0x2189, UC_No}, {0x218a, 0x218b, UC_So},
+	{0x2190, 0x2194, UC_Sm}, {0x2195, 0x2199, UC_So}, {0x219a, 0x219b, UC_Sm},
+	{0x219c, 0x219f, UC_So}, {0x21a0, 0x21a0, UC_Sm}, {0x21a1, 0x21a2, UC_So},
+	{0x21a3, 0x21a3, UC_Sm}, {0x21a4, 0x21a5, UC_So}, {0x21a6, 0x21a6, UC_Sm},
+	{0x21a7, 0x21ad, UC_So}, {0x21ae, 0x21ae, UC_Sm}, {0x21af, 0x21cd, UC_So},
+	{0x21ce, 0x21cf, UC_Sm}, {0x21d0, 0x21d1, UC_So}, {0x21d2, 0x21d2, UC_Sm},
+	{0x21d3, 0x21d3, UC_So}, {0x21d4, 0x21d4, UC_Sm}, {0x21d5, 0x21f3, UC_So},
+	{0x21f4, 0x22ff, UC_Sm}, {0x2300, 0x2307, UC_So}, {0x2308, 0x2308, UC_Ps},
+	{0x2309, 0x2309, UC_Pe}, {0x230a, 0x230a, UC_Ps}, {0x230b, 0x230b, UC_Pe},
+	{0x230c, 0x231f, UC_So}, {0x2320, 0x2321, UC_Sm}, {0x2322, 0x2328, UC_So},
+	{0x2329, 0x2329, UC_Ps}, {0x232a, 0x232a, UC_Pe}, {0x232b, 0x237b, UC_So},
+	{0x237c, 0x237c, UC_Sm}, {0x237d, 0x239a, UC_So}, {0x239b, 0x23b3, UC_Sm},
+	{0x23b4, 0x23db, UC_So}, {0x23dc, 0x23e1, UC_Sm}, {0x23e2, 0x2426, UC_So},
+	{0x2440, 0x244a, UC_So}, {0x2460, 0x249b, UC_No}, {0x249c, 0x24e9, UC_So},
+	{0x24ea, 0x24ff, UC_No}, {0x2500, 0x25b6, UC_So}, {0x25b7, 0x25b7, UC_Sm},
+	{0x25b8, 0x25c0, UC_So}, {0x25c1, 0x25c1, UC_Sm}, {0x25c2, 0x25f7, UC_So},
+	{0x25f8, 0x25ff, UC_Sm}, {0x2600, 0x266e, UC_So}, {0x266f, 0x266f, UC_Sm},
+	{0x2670, 0x2767, UC_So}, {0x2768, 0x2768, UC_Ps}, {0x2769, 0x2769, UC_Pe},
+	{0x276a, 0x276a, UC_Ps}, {0x276b, 0x276b, UC_Pe}, {0x276c, 0x276c, UC_Ps},
+	{0x276d, 0x276d, UC_Pe}, {0x276e, 0x276e, UC_Ps}, {0x276f, 0x276f, UC_Pe},
+	{0x2770, 0x2770, UC_Ps}, {0x2771, 0x2771, UC_Pe}, {0x2772, 0x2772, UC_Ps},
+	{0x2773, 0x2773, UC_Pe}, {0x2774, 0x2774, UC_Ps}, {0x2775, 0x2775, UC_Pe},
+	{0x2776, 0x2793, UC_No}, {0x2794, 0x27bf, UC_So}, {0x27c0, 0x27c4, UC_Sm},
+	{0x27c5, 0x27c5, UC_Ps}, {0x27c6, 0x27c6, UC_Pe}, {0x27c7, 0x27e5, UC_Sm},
+	{0x27e6, 0x27e6, UC_Ps}, {0x27e7, 0x27e7, UC_Pe}, {0x27e8, 0x27e8, UC_Ps},
+	{0x27e9, 0x27e9, UC_Pe}, {0x27ea, 0x27ea, UC_Ps}, {0x27eb, 0x27eb, UC_Pe},
+	{0x27ec, 0x27ec, UC_Ps}, {0x27ed, 0x27ed, UC_Pe}, {0x27ee, 0x27ee, UC_Ps},
+	{0x27ef, 0x27ef, UC_Pe}, {0x27f0, 0x27ff, UC_Sm}, {0x2800, 0x28ff, UC_So},
+	{0x2900, 0x2982, UC_Sm}, {0x2983, 0x2983, UC_Ps}, {0x2984, 0x2984, UC_Pe},
+	{0x2985, 0x2985, UC_Ps}, {0x2986, 0x2986, UC_Pe}, {0x2987, 0x2987, UC_Ps},
+	{0x2988, 0x2988, UC_Pe}, {0x2989, 0x2989, UC_Ps}, {0x298a, 0x298a, UC_Pe},
+	{0x298b, 0x298b, UC_Ps}, {0x298c, 0x298c, UC_Pe}, {0x298d, 0x298d, UC_Ps},
+	{0x298e, 0x298e, UC_Pe}, {0x298f, 0x298f, UC_Ps}, {0x2990, 0x2990, UC_Pe},
+	{0x2991, 0x2991, UC_Ps}, {0x2992, 0x2992, UC_Pe}, {0x2993, 0x2993, UC_Ps},
+	{0x2994, 0x2994, UC_Pe}, {0x2995, 0x2995, UC_Ps}, {0x2996, 0x2996, UC_Pe},
+	{0x2997, 0x2997, UC_Ps}, {0x2998, 0x2998, UC_Pe}, {0x2999, 0x29d7, UC_Sm},
+	{0x29d8, 0x29d8, UC_Ps}, {0x29d9, 0x29d9, UC_Pe}, {0x29da, 0x29da, UC_Ps},
+	{0x29db, 0x29db, UC_Pe}, {0x29dc, 0x29fb, UC_Sm}, {0x29fc, 0x29fc, UC_Ps},
+	{0x29fd, 0x29fd, UC_Pe}, {0x29fe, 0x2aff, UC_Sm}, {0x2b00, 0x2b2f, UC_So},
+	{0x2b30, 0x2b44, UC_Sm}, {0x2b45, 0x2b46, UC_So}, {0x2b47, 0x2b4c, UC_Sm},
+	{0x2b4d, 0x2b73, UC_So}, {0x2b76, 0x2b95, UC_So}, {0x2b97, 0x2bff, UC_So},
+	{0x2c00, 0x2c2f, UC_Lu}, {0x2c30, 0x2c5f, UC_Ll}, {0x2c60, 0x2c60, UC_Lu},
+	{0x2c61, 0x2c61, UC_Ll}, {0x2c62, 0x2c64, UC_Lu}, {0x2c65, 0x2c66, UC_Ll},
+	{0x2c67, 0x2c67, UC_Lu}, {0x2c68, 0x2c68, UC_Ll}, {0x2c69, 0x2c69, UC_Lu},
+	{0x2c6a, 0x2c6a, UC_Ll}, {0x2c6b, 0x2c6b, UC_Lu}, {0x2c6c, 0x2c6c, UC_Ll},
+	{0x2c6d, 0x2c70, UC_Lu}, {0x2c71, 0x2c71, UC_Ll}, {0x2c72, 0x2c72, UC_Lu},
+	{0x2c73, 0x2c74, UC_Ll}, {0x2c75, 0x2c75, UC_Lu}, {0x2c76, 0x2c7b, UC_Ll},
+	{0x2c7c, 0x2c7d, UC_Lm}, {0x2c7e, 0x2c80, UC_Lu}, {0x2c81, 0x2c81, UC_Ll},
+	{0x2c82, 0x2c82, UC_Lu}, {0x2c83, 0x2c83, UC_Ll}, {0x2c84, 0x2c84, UC_Lu},
+	{0x2c85, 0x2c85, UC_Ll}, {0x2c86, 0x2c86, UC_Lu}, {0x2c87, 0x2c87, UC_Ll},
+	{0x2c88, 0x2c88, UC_Lu}, {0x2c89, 0x2c89, UC_Ll}, {0x2c8a, 0x2c8a, UC_Lu},
+	{0x2c8b, 0x2c8b, UC_Ll}, {0x2c8c, 0x2c8c, UC_Lu}, {0x2c8d, 0x2c8d, UC_Ll},
+	{0x2c8e, 0x2c8e, UC_Lu}, {0x2c8f, 0x2c8f, UC_Ll}, {0x2c90, 0x2c90, UC_Lu},
+	{0x2c91, 0x2c91, UC_Ll}, {0x2c92, 0x2c92, UC_Lu}, {0x2c93, 0x2c93, UC_Ll},
+	{0x2c94, 0x2c94, UC_Lu}, {0x2c95, 0x2c95, UC_Ll}, {0x2c96, 0x2c96, UC_Lu},
+	{0x2c97, 0x2c97, UC_Ll}, {0x2c98, 0x2c98, UC_Lu}, {0x2c99, 0x2c99, UC_Ll},
+	{0x2c9a, 0x2c9a, UC_Lu}, {0x2c9b, 0x2c9b, UC_Ll}, {0x2c9c, 0x2c9c, UC_Lu},
+	{0x2c9d, 0x2c9d, UC_Ll}, {0x2c9e, 0x2c9e, UC_Lu}, {0x2c9f, 0x2c9f, UC_Ll},
+	{0x2ca0, 0x2ca0, UC_Lu}, {0x2ca1, 0x2ca1, UC_Ll}, {0x2ca2, 0x2ca2, UC_Lu},
+	{0x2ca3, 0x2ca3, UC_Ll}, {0x2ca4, 0x2ca4, UC_Lu}, {0x2ca5, 0x2ca5, UC_Ll},
+	{0x2ca6, 0x2ca6, UC_Lu}, {0x2ca7, 0x2ca7, UC_Ll}, {0x2ca8, 0x2ca8, UC_Lu},
+	{0x2ca9, 0x2ca9, UC_Ll}, {0x2caa, 0x2caa, UC_Lu}, {0x2cab, 0x2cab, UC_Ll},
+	{0x2cac, 0x2cac, UC_Lu}, {0x2cad, 0x2cad, UC_Ll}, {0x2cae, 0x2cae, UC_Lu},
+	{0x2caf, 0x2caf, UC_Ll}, {0x2cb0, 0x2cb0, UC_Lu}, {0x2cb1, 0x2cb1, UC_Ll},
+	{0x2cb2, 0x2cb2, UC_Lu}, {0x2cb3, 0x2cb3, UC_Ll}, {0x2cb4, 0x2cb4, UC_Lu},
+	{0x2cb5, 0x2cb5, UC_Ll}, {0x2cb6, 0x2cb6, UC_Lu}, {0x2cb7, 0x2cb7, UC_Ll},
+	{0x2cb8, 0x2cb8, UC_Lu}, {0x2cb9, 0x2cb9, UC_Ll}, {0x2cba, 0x2cba, UC_Lu},
+	{0x2cbb, 0x2cbb, UC_Ll}, {0x2cbc, 0x2cbc, UC_Lu}, {0x2cbd, 0x2cbd, UC_Ll},
+	{0x2cbe, 0x2cbe, UC_Lu}, {0x2cbf, 0x2cbf, UC_Ll}, {0x2cc0, 0x2cc0, UC_Lu},
+	{0x2cc1, 0x2cc1, UC_Ll}, {0x2cc2, 0x2cc2, UC_Lu}, {0x2cc3, 0x2cc3, UC_Ll},
+	{0x2cc4, 0x2cc4, UC_Lu}, {0x2cc5, 0x2cc5, UC_Ll}, {0x2cc6, 0x2cc6, UC_Lu},
+	{0x2cc7, 0x2cc7, UC_Ll}, {0x2cc8, 0x2cc8, UC_Lu}, {0x2cc9, 0x2cc9, UC_Ll},
+	{0x2cca, 0x2cca, UC_Lu}, {0x2ccb, 0x2ccb, UC_Ll}, {0x2ccc, 0x2ccc, UC_Lu},
+	{0x2ccd, 0x2ccd, UC_Ll}, {0x2cce, 0x2cce, UC_Lu}, {0x2ccf, 0x2ccf, UC_Ll},
+	{0x2cd0, 0x2cd0, UC_Lu}, {0x2cd1, 0x2cd1, UC_Ll}, {0x2cd2, 0x2cd2, UC_Lu},
+	{0x2cd3, 0x2cd3, UC_Ll}, {0x2cd4, 0x2cd4, UC_Lu}, {0x2cd5, 0x2cd5, UC_Ll},
+	{0x2cd6, 0x2cd6, UC_Lu}, {0x2cd7, 0x2cd7, UC_Ll}, {0x2cd8, 0x2cd8, UC_Lu},
+	{0x2cd9, 0x2cd9, UC_Ll}, {0x2cda, 0x2cda, UC_Lu}, {0x2cdb, 0x2cdb, UC_Ll},
+	{0x2cdc, 0x2cdc, UC_Lu}, {0x2cdd, 0x2cdd, UC_Ll}, {0x2cde, 0x2cde, UC_Lu},
+	{0x2cdf, 0x2cdf, UC_Ll}, {0x2ce0, 0x2ce0, UC_Lu}, {0x2ce1, 0x2ce1, UC_Ll},
+	{0x2ce2, 0x2ce2, UC_Lu}, {0x2ce3, 0x2ce4, UC_Ll}, {0x2ce5, 0x2cea, UC_So},
+	{0x2ceb, 0x2ceb, UC_Lu}, {0x2cec, 0x2cec, UC_Ll}, {0x2ced, 0x2ced, UC_Lu},
+	{0x2cee, 0x2cee, UC_Ll}, {0x2cef, 0x2cf1, UC_Mn}, {0x2cf2, 0x2cf2, UC_Lu},
+	{0x2cf3, 0x2cf3, UC_Ll}, {0x2cf9, 0x2cfc, UC_Po}, {0x2cfd, 0x2cfd, UC_No},
+	{0x2cfe, 0x2cff, UC_Po}, {0x2d00, 0x2d25, UC_Ll}, {0x2d27, 0x2d27, UC_Ll},
+	{0x2d2d, 0x2d2d, UC_Ll}, {0x2d30, 0x2d67, UC_Lo}, {0x2d6f, 0x2d6f, UC_Lm},
+	{0x2d70, 0x2d70, UC_Po}, {0x2d7f, 0x2d7f, UC_Mn}, {0x2d80, 0x2d96, UC_Lo},
+	{0x2da0, 0x2da6, UC_Lo}, {0x2da8, 0x2dae, UC_Lo}, {0x2db0, 0x2db6, UC_Lo},
+	{0x2db8, 0x2dbe, UC_Lo}, {0x2dc0, 0x2dc6, UC_Lo}, {0x2dc8, 0x2dce, UC_Lo},
+	{0x2dd0, 0x2dd6, UC_Lo}, {0x2dd8, 0x2dde, UC_Lo}, {0x2de0, 0x2dff, UC_Mn},
+	{0x2e00, 0x2e01, UC_Po}, {0x2e02, 0x2e02, UC_Pi}, {0x2e03, 0x2e03, UC_Pf},
+	{0x2e04, 0x2e04, UC_Pi}, {0x2e05, 0x2e05, UC_Pf}, {0x2e06, 0x2e08, UC_Po},
+	{0x2e09, 0x2e09, UC_Pi}, {0x2e0a, 0x2e0a, UC_Pf}, {0x2e0b, 0x2e0b, UC_Po},
+	{0x2e0c, 0x2e0c, UC_Pi}, {0x2e0d, 0x2e0d, UC_Pf}, {0x2e0e, 0x2e16, UC_Po},
+	{0x2e17, 0x2e17, UC_Pd}, {0x2e18, 0x2e19, UC_Po}, {0x2e1a, 0x2e1a, UC_Pd},
+	{0x2e1b, 0x2e1b, UC_Po}, {0x2e1c, 0x2e1c, UC_Pi}, {0x2e1d, 0x2e1d, UC_Pf},
+	{0x2e1e, 0x2e1f, UC_Po}, {0x2e20, 0x2e20, UC_Pi}, {0x2e21, 0x2e21, UC_Pf},
+	{0x2e22, 0x2e22, UC_Ps}, {0x2e23, 0x2e23, UC_Pe}, {0x2e24, 0x2e24, UC_Ps},
+	{0x2e25, 0x2e25, UC_Pe}, {0x2e26, 0x2e26, UC_Ps}, {0x2e27, 0x2e27, UC_Pe},
+	{0x2e28, 0x2e28, UC_Ps}, {0x2e29, 0x2e29, UC_Pe}, {0x2e2a, 0x2e2e, UC_Po},
+	{0x2e2f, 0x2e2f, UC_Lm}, {0x2e30, 0x2e39, UC_Po}, {0x2e3a, 0x2e3b, UC_Pd},
+	{0x2e3c, 0x2e3f, UC_Po}, {0x2e40, 0x2e40, UC_Pd}, {0x2e41, 0x2e41, UC_Po},
+	{0x2e42, 0x2e42, UC_Ps}, {0x2e43, 0x2e4f, UC_Po}, {0x2e50, 0x2e51, UC_So},
+	{0x2e52, 0x2e54, UC_Po}, {0x2e55, 0x2e55, UC_Ps}, {0x2e56, 0x2e56, UC_Pe},
+	{0x2e57, 0x2e57, UC_Ps}, {0x2e58, 0x2e58, UC_Pe}, {0x2e59, 0x2e59, UC_Ps},
+	{0x2e5a, 0x2e5a, UC_Pe}, {0x2e5b, 0x2e5b, UC_Ps}, {0x2e5c, 0x2e5c, UC_Pe},
+	{0x2e5d, 0x2e5d, UC_Pd}, {0x2e80, 0x2e99, UC_So}, {0x2e9b, 0x2ef3, UC_So},
+	{0x2f00, 0x2fd5, UC_So}, {0x2ff0, 0x2ffb, UC_So}, {0x3000, 0x3000, UC_Zs},
+	{0x3001, 0x3003, UC_Po}, {0x3004, 0x3004, UC_So}, {0x3005, 0x3005, UC_Lm},
+	{0x3006, 0x3006, UC_Lo}, {0x3007, 0x3007, UC_Nl}, {0x3008, 0x3008, UC_Ps},
+	{0x3009, 0x3009, UC_Pe}, {0x300a, 0x300a, UC_Ps}, {0x300b, 0x300b, UC_Pe},
+	{0x300c, 0x300c, UC_Ps}, {0x300d, 0x300d, UC_Pe}, {0x300e, 0x300e, UC_Ps},
+	{0x300f, 0x300f, UC_Pe}, {0x3010, 0x3010, UC_Ps}, {0x3011, 0x3011, UC_Pe},
+	{0x3012, 0x3013, UC_So}, {0x3014, 0x3014, UC_Ps}, {0x3015, 0x3015, UC_Pe},
+	{0x3016, 0x3016, UC_Ps}, {0x3017, 0x3017, UC_Pe}, {0x3018, 0x3018, UC_Ps},
+	{0x3019, 0x3019, UC_Pe}, {0x301a, 0x301a, UC_Ps}, {0x301b, 0x301b, UC_Pe},
+	{0x301c, 0x301c, UC_Pd}, {0x301d, 0x301d, UC_Ps}, {0x301e, 0x301f, UC_Pe},
+	{0x3020, 0x3020, UC_So}, {0x3021, 0x3029, UC_Nl}, {0x302a, 0x302d, UC_Mn},
+	{0x302e, 0x302f, UC_Mc}, {0x3030, 0x3030, UC_Pd}, {0x3031, 0x3035, UC_Lm},
+	{0x3036, 0x3037, UC_So}, {0x3038, 0x303a, UC_Nl}, {0x303b, 0x303b, UC_Lm},
+	{0x303c, 0x303c, UC_Lo}, {0x303d, 0x303d, UC_Po}, {0x303e, 0x303f, UC_So},
+	{0x3041, 0x3096, UC_Lo}, {0x3099, 0x309a, UC_Mn}, {0x309b, 0x309c, UC_Sk},
+	{0x309d, 0x309e, UC_Lm}, {0x309f, 0x309f, UC_Lo}, {0x30a0, 0x30a0, UC_Pd},
+	{0x30a1, 0x30fa, UC_Lo}, {0x30fb, 0x30fb, UC_Po}, {0x30fc, 0x30fe, UC_Lm},
+	{0x30ff, 0x30ff, UC_Lo}, {0x3105, 0x312f, UC_Lo}, {0x3131, 0x318e, UC_Lo},
+	{0x3190, 0x3191, UC_So}, {0x3192, 0x3195, UC_No}, {0x3196, 0x319f, UC_So},
+	{0x31a0, 0x31bf, UC_Lo}, {0x31c0, 0x31e3, UC_So}, {0x31f0, 0x31ff, UC_Lo},
+	{0x3200, 0x321e, UC_So}, {0x3220, 0x3229, UC_No}, {0x322a, 0x3247, UC_So},
+	{0x3248, 0x324f, UC_No}, {0x3250, 0x3250, UC_So}, {0x3251, 0x325f, UC_No},
+	{0x3260, 0x327f, UC_So}, {0x3280, 0x3289, UC_No}, {0x328a, 0x32b0, UC_So},
+	{0x32b1, 0x32bf, UC_No}, {0x32c0, 0x33ff, UC_So}, {0x3400, 0x4dbf, UC_Lo},
+	{0x4dc0, 0x4dff, UC_So}, {0x4e00, 0xa014, UC_Lo}, {0xa015, 0xa015, UC_Lm},
+	{0xa016, 0xa48c, UC_Lo}, {0xa490, 0xa4c6, UC_So}, {0xa4d0, 0xa4f7, UC_Lo},
+	{0xa4f8, 0xa4fd, UC_Lm}, {0xa4fe, 0xa4ff, UC_Po}, {0xa500, 0xa60b, UC_Lo},
+	{0xa60c, 0xa60c, UC_Lm}, {0xa60d, 0xa60f, UC_Po}, {0xa610, 0xa61f, UC_Lo},
+	{0xa620, 0xa629, UC_Nd}, {0xa62a, 0xa62b, UC_Lo}, {0xa640, 0xa640, UC_Lu},
+	{0xa641, 0xa641, UC_Ll}, {0xa642, 0xa642, UC_Lu}, {0xa643, 0xa643, UC_Ll},
+	{0xa644, 0xa644, UC_Lu}, {0xa645, 0xa645, UC_Ll}, {0xa646, 0xa646, UC_Lu},
+	{0xa647, 0xa647, UC_Ll}, {0xa648, 0xa648, UC_Lu}, {0xa649, 0xa649, UC_Ll},
+	{0xa64a, 0xa64a, UC_Lu}, {0xa64b, 0xa64b, UC_Ll}, {0xa64c, 0xa64c, UC_Lu},
+	{0xa64d, 0xa64d, UC_Ll}, {0xa64e, 0xa64e, UC_Lu}, {0xa64f, 0xa64f, UC_Ll},
+	{0xa650, 0xa650, UC_Lu}, {0xa651, 0xa651, UC_Ll}, {0xa652, 0xa652, UC_Lu},
+	{0xa653, 0xa653, UC_Ll}, {0xa654, 0xa654, UC_Lu}, {0xa655, 0xa655, UC_Ll},
+	{0xa656, 0xa656, UC_Lu}, {0xa657, 0xa657, UC_Ll}, {0xa658, 0xa658, UC_Lu},
+	{0xa659, 0xa659, UC_Ll}, {0xa65a, 0xa65a, UC_Lu}, {0xa65b, 0xa65b, UC_Ll},
+	{0xa65c, 0xa65c, UC_Lu}, {0xa65d, 0xa65d, UC_Ll}, {0xa65e, 0xa65e, UC_Lu},
+	{0xa65f, 0xa65f, UC_Ll}, {0xa660, 0xa660, UC_Lu}, {0xa661, 0xa661, UC_Ll},
+	{0xa662, 0xa662, UC_Lu}, {0xa663, 0xa663, UC_Ll}, {0xa664, 0xa664, UC_Lu},
+	{0xa665, 0xa665, UC_Ll}, {0xa666, 0xa666, UC_Lu}, {0xa667, 0xa667, UC_Ll},
+	{0xa668, 0xa668, UC_Lu}, {0xa669, 0xa669, UC_Ll}, {0xa66a, 0xa66a, UC_Lu},
+	{0xa66b, 0xa66b, UC_Ll}, {0xa66c, 0xa66c, UC_Lu}, {0xa66d, 0xa66d, UC_Ll},
+	{0xa66e, 0xa66e, UC_Lo}, {0xa66f, 0xa66f, UC_Mn}, {0xa670, 0xa672, UC_Me},
+	{0xa673, 0xa673, UC_Po}, {0xa674, 0xa67d, UC_Mn}, {0xa67e, 0xa67e, UC_Po},
+	{0xa67f, 0xa67f, UC_Lm}, {0xa680, 0xa680, UC_Lu}, {0xa681, 0xa681, UC_Ll},
+	{0xa682, 0xa682, UC_Lu}, {0xa683, 0xa683, UC_Ll}, {0xa684, 0xa684, UC_Lu},
+	{0xa685, 0xa685, UC_Ll}, {0xa686, 0xa686, UC_Lu}, {0xa687, 0xa687, UC_Ll},
+	{0xa688, 0xa688, UC_Lu}, {0xa689, 0xa689, UC_Ll}, {0xa68a, 0xa68a, UC_Lu},
+	{0xa68b, 0xa68b, UC_Ll}, {0xa68c, 0xa68c, UC_Lu}, {0xa68d, 0xa68d, UC_Ll},
+	{0xa68e, 0xa68e, UC_Lu}, {0xa68f, 0xa68f, UC_Ll}, {0xa690, 0xa690, UC_Lu},
+	{0xa691, 0xa691, UC_Ll}, {0xa692, 0xa692, UC_Lu}, {0xa693, 0xa693, UC_Ll},
+	{0xa694, 0xa694, UC_Lu}, {0xa695, 0xa695, UC_Ll}, {0xa696, 0xa696, UC_Lu},
+	{0xa697, 0xa697, UC_Ll}, {0xa698, 0xa698, UC_Lu}, {0xa699, 0xa699, UC_Ll},
+	{0xa69a, 0xa69a, UC_Lu}, {0xa69b, 0xa69b, UC_Ll}, {0xa69c, 0xa69d, UC_Lm},
+	{0xa69e, 0xa69f, UC_Mn}, {0xa6a0, 0xa6e5, UC_Lo}, {0xa6e6, 0xa6ef, UC_Nl},
+	{0xa6f0, 0xa6f1, UC_Mn}, {0xa6f2, 0xa6f7, UC_Po}, {0xa700, 0xa716, UC_Sk},
+	{0xa717, 0xa71f, UC_Lm}, {0xa720, 0xa721, UC_Sk}, {0xa722, 0xa722, UC_Lu},
+	{0xa723, 0xa723, UC_Ll}, {0xa724, 0xa724, UC_Lu}, {0xa725, 0xa725, UC_Ll},
+	{0xa726, 0xa726, UC_Lu}, {0xa727, 0xa727, UC_Ll}, {0xa728, 0xa728, UC_Lu},
+	{0xa729, 0xa729, UC_Ll}, {0xa72a, 0xa72a, UC_Lu}, {0xa72b, 0xa72b, UC_Ll},
+	{0xa72c, 0xa72c, UC_Lu}, {0xa72d, 0xa72d, UC_Ll}, {0xa72e, 0xa72e, UC_Lu},
+	{0xa72f, 0xa731, UC_Ll}, {0xa732, 0xa732, UC_Lu}, {0xa733, 0xa733, UC_Ll},
+	{0xa734, 0xa734, UC_Lu}, {0xa735, 0xa735, UC_Ll}, {0xa736, 0xa736, UC_Lu},
+	{0xa737, 0xa737, UC_Ll}, {0xa738, 0xa738, UC_Lu}, {0xa739, 0xa739, UC_Ll},
+	{0xa73a, 0xa73a, UC_Lu}, {0xa73b, 0xa73b, UC_Ll}, {0xa73c, 0xa73c, UC_Lu},
+	{0xa73d, 0xa73d, UC_Ll}, {0xa73e, 0xa73e, UC_Lu}, {0xa73f, 0xa73f, UC_Ll},
+	{0xa740, 0xa740, UC_Lu}, {0xa741, 0xa741, UC_Ll}, {0xa742, 0xa742, UC_Lu},
+	{0xa743, 0xa743, UC_Ll}, {0xa744, 0xa744, UC_Lu}, {0xa745, 0xa745, UC_Ll},
+	{0xa746, 0xa746, UC_Lu}, {0xa747, 0xa747, UC_Ll}, {0xa748, 0xa748, UC_Lu},
+	{0xa749, 0xa749, UC_Ll}, {0xa74a, 0xa74a, UC_Lu}, {0xa74b, 0xa74b, UC_Ll},
+	{0xa74c, 0xa74c, UC_Lu}, {0xa74d, 0xa74d, UC_Ll}, {0xa74e, 0xa74e, UC_Lu},
+	{0xa74f, 0xa74f, UC_Ll}, {0xa750, 0xa750, UC_Lu}, {0xa751, 0xa751, UC_Ll},
+	{0xa752, 0xa752, UC_Lu}, {0xa753, 0xa753, UC_Ll}, {0xa754, 0xa754, UC_Lu},
+	{0xa755, 0xa755, UC_Ll}, {0xa756, 0xa756, UC_Lu}, {0xa757, 0xa757, UC_Ll},
+	{0xa758, 0xa758, UC_Lu}, {0xa759, 0xa759, UC_Ll}, {0xa75a, 0xa75a, UC_Lu},
+	{0xa75b, 0xa75b, UC_Ll}, {0xa75c, 0xa75c, UC_Lu}, {0xa75d, 0xa75d, UC_Ll},
+	{0xa75e, 0xa75e, UC_Lu}, {0xa75f, 0xa75f, UC_Ll}, {0xa760, 0xa760, UC_Lu},
+	{0xa761, 0xa761, UC_Ll}, {0xa762, 0xa762, UC_Lu}, {0xa763, 0xa763, UC_Ll},
+	{0xa764, 0xa764, UC_Lu}, {0xa765, 0xa765, UC_Ll}, {0xa766, 0xa766, UC_Lu},
+	{0xa767, 0xa767, UC_Ll}, {0xa768, 0xa768, UC_Lu}, {0xa769, 0xa769, UC_Ll},
+	{0xa76a, 0xa76a, UC_Lu}, {0xa76b, 0xa76b, UC_Ll}, {0xa76c, 0xa76c, UC_Lu},
+	{0xa76d, 0xa76d, UC_Ll}, {0xa76e, 0xa76e, UC_Lu}, {0xa76f, 0xa76f, UC_Ll},
+	{0xa770, 0xa770, UC_Lm}, {0xa771, 0xa778, UC_Ll}, {0xa779, 0xa779, UC_Lu},
+	{0xa77a, 0xa77a, UC_Ll}, {0xa77b, 0xa77b, UC_Lu}, {0xa77c, 0xa77c, UC_Ll},
+	{0xa77d, 0xa77e, UC_Lu}, {0xa77f, 0xa77f, UC_Ll}, {0xa780, 0xa780, UC_Lu},
+	{0xa781, 0xa781, UC_Ll}, {0xa782, 0xa782, UC_Lu}, {0xa783, 0xa783, UC_Ll},
+	{0xa784, 0xa784, UC_Lu}, {0xa785, 0xa785, UC_Ll}, {0xa786, 0xa786, UC_Lu},
+	{0xa787, 0xa787, UC_Ll}, {0xa788, 0xa788, UC_Lm}, {0xa789, 0xa78a, UC_Sk},
+	{0xa78b, 0xa78b, UC_Lu}, {0xa78c, 0xa78c, UC_Ll}, {0xa78d, 0xa78d, UC_Lu},
+	{0xa78e, 0xa78e, UC_Ll}, {0xa78f, 0xa78f, UC_Lo}, {0xa790, 0xa790, UC_Lu},
+	{0xa791, 0xa791, UC_Ll}, {0xa792, 0xa792, UC_Lu}, {0xa793, 0xa795, UC_Ll},
+	{0xa796, 0xa796, UC_Lu}, {0xa797, 0xa797, UC_Ll}, {0xa798, 0xa798, UC_Lu},
+	{0xa799, 0xa799, UC_Ll}, {0xa79a, 0xa79a, UC_Lu}, {0xa79b, 0xa79b, UC_Ll},
+	{0xa79c, 0xa79c, UC_Lu}, {0xa79d, 0xa79d, UC_Ll}, {0xa79e, 0xa79e, UC_Lu},
+	{0xa79f, 0xa79f, UC_Ll}, {0xa7a0, 0xa7a0, UC_Lu}, {0xa7a1, 0xa7a1, UC_Ll},
+	{0xa7a2, 0xa7a2, UC_Lu}, {0xa7a3, 0xa7a3, UC_Ll}, {0xa7a4, 0xa7a4, UC_Lu},
+	{0xa7a5, 0xa7a5, UC_Ll}, {0xa7a6, 0xa7a6, UC_Lu}, {0xa7a7, 0xa7a7, UC_Ll},
+	{0xa7a8, 0xa7a8, UC_Lu}, {0xa7a9, 0xa7a9, UC_Ll}, {0xa7aa, 0xa7ae, UC_Lu},
+	{0xa7af, 0xa7af, UC_Ll}, {0xa7b0, 0xa7b4, UC_Lu}, {0xa7b5, 0xa7b5, UC_Ll},
+	{0xa7b6, 0xa7b6, UC_Lu}, {0xa7b7, 0xa7b7, UC_Ll}, {0xa7b8, 0xa7b8, UC_Lu},
+	{0xa7b9, 0xa7b9, UC_Ll}, {0xa7ba, 0xa7ba, UC_Lu}, {0xa7bb, 0xa7bb, UC_Ll},
+	{0xa7bc, 0xa7bc, UC_Lu}, {0xa7bd, 0xa7bd, UC_Ll}, {0xa7be, 0xa7be, UC_Lu},
+	{0xa7bf, 0xa7bf, UC_Ll}, {0xa7c0, 0xa7c0, UC_Lu}, {0xa7c1, 0xa7c1, UC_Ll},
+	{0xa7c2, 0xa7c2, UC_Lu}, {0xa7c3, 0xa7c3, UC_Ll}, {0xa7c4, 0xa7c7, UC_Lu},
+	{0xa7c8, 0xa7c8, UC_Ll}, {0xa7c9, 0xa7c9, UC_Lu}, {0xa7ca, 0xa7ca, UC_Ll},
+	{0xa7d0, 0xa7d0, UC_Lu}, {0xa7d1, 0xa7d1, UC_Ll}, {0xa7d3, 0xa7d3, UC_Ll},
+	{0xa7d5, 0xa7d5, UC_Ll}, {0xa7d6, 0xa7d6, UC_Lu}, {0xa7d7, 0xa7d7, UC_Ll},
+	{0xa7d8, 0xa7d8, UC_Lu}, {0xa7d9, 0xa7d9, UC_Ll}, {0xa7f2, 0xa7f4, UC_Lm},
+	{0xa7f5, 0xa7f5, UC_Lu}, {0xa7f6, 0xa7f6, UC_Ll}, {0xa7f7, 0xa7f7, UC_Lo},
+	{0xa7f8, 0xa7f9, UC_Lm}, {0xa7fa, 0xa7fa, UC_Ll}, {0xa7fb, 0xa801, UC_Lo},
+	{0xa802, 0xa802, UC_Mn}, {0xa803, 0xa805, UC_Lo}, {0xa806, 0xa806, UC_Mn},
+	{0xa807, 0xa80a, UC_Lo}, {0xa80b, 0xa80b, UC_Mn}, {0xa80c, 0xa822, UC_Lo},
+	{0xa823, 0xa824, UC_Mc}, {0xa825, 0xa826, UC_Mn}, {0xa827, 0xa827, UC_Mc},
+	{0xa828, 0xa82b, UC_So}, {0xa82c, 0xa82c, UC_Mn}, {0xa830, 0xa835, UC_No},
+	{0xa836, 0xa837, UC_So}, {0xa838, 0xa838, UC_Sc}, {0xa839, 0xa839, UC_So},
+	{0xa840, 0xa873, UC_Lo}, {0xa874, 0xa877, UC_Po}, {0xa880, 0xa881, UC_Mc},
+	{0xa882, 0xa8b3, UC_Lo}, {0xa8b4, 0xa8c3, UC_Mc}, {0xa8c4, 0xa8c5, UC_Mn},
+	{0xa8ce, 0xa8cf, UC_Po}, {0xa8d0, 0xa8d9, UC_Nd}, {0xa8e0, 0xa8f1, UC_Mn},
+	{0xa8f2, 0xa8f7, UC_Lo}, {0xa8f8, 0xa8fa, UC_Po}, {0xa8fb, 0xa8fb, UC_Lo},
+	{0xa8fc, 0xa8fc, UC_Po}, {0xa8fd, 0xa8fe, UC_Lo}, {0xa8ff, 0xa8ff, UC_Mn},
+	{0xa900, 0xa909, UC_Nd}, {0xa90a, 0xa925, UC_Lo}, {0xa926, 0xa92d, UC_Mn},
+	{0xa92e, 0xa92f, UC_Po}, {0xa930, 0xa946, UC_Lo}, {0xa947, 0xa951, UC_Mn},
+	{0xa952, 0xa953, UC_Mc}, {0xa95f, 0xa95f, UC_Po}, {0xa960, 0xa97c, UC_Lo},
+	{0xa980, 0xa982, UC_Mn}, {0xa983, 0xa983, UC_Mc}, {0xa984, 0xa9b2, UC_Lo},
+	{0xa9b3, 0xa9b3, UC_Mn}, {0xa9b4, 0xa9b5, UC_Mc}, {0xa9b6, 0xa9b9, UC_Mn},
+	{0xa9ba, 0xa9bb, UC_Mc}, {0xa9bc, 0xa9bd, UC_Mn}, {0xa9be, 0xa9c0, UC_Mc},
+	{0xa9c1, 0xa9cd, UC_Po}, {0xa9cf, 0xa9cf, UC_Lm}, {0xa9d0, 0xa9d9, UC_Nd},
+	{0xa9de, 0xa9df, UC_Po}, {0xa9e0, 0xa9e4, UC_Lo}, {0xa9e5, 0xa9e5, UC_Mn},
+	{0xa9e6, 0xa9e6, UC_Lm}, {0xa9e7, 0xa9ef, UC_Lo}, {0xa9f0, 0xa9f9, UC_Nd},
+	{0xa9fa, 0xa9fe, UC_Lo}, {0xaa00, 0xaa28, UC_Lo}, {0xaa29, 0xaa2e, UC_Mn},
+	{0xaa2f, 0xaa30, UC_Mc}, {0xaa31, 0xaa32, UC_Mn}, {0xaa33, 0xaa34, UC_Mc},
+	{0xaa35, 0xaa36, UC_Mn}, {0xaa40, 0xaa42, UC_Lo}, {0xaa43, 0xaa43, UC_Mn},
+	{0xaa44, 0xaa4b, UC_Lo}, {0xaa4c, 0xaa4c, UC_Mn}, {0xaa4d, 0xaa4d, UC_Mc},
+	{0xaa50, 0xaa59, UC_Nd}, {0xaa5c, 0xaa5f, UC_Po}, {0xaa60, 0xaa6f, UC_Lo},
+	{0xaa70, 0xaa70, UC_Lm}, {0xaa71, 0xaa76, UC_Lo}, {0xaa77, 0xaa79, UC_So},
+	{0xaa7a, 0xaa7a, UC_Lo}, {0xaa7b, 0xaa7b, UC_Mc}, {0xaa7c, 0xaa7c, UC_Mn},
+	{0xaa7d, 0xaa7d, UC_Mc}, {0xaa7e, 0xaaaf, UC_Lo}, {0xaab0, 0xaab0, UC_Mn},
+	{0xaab1, 0xaab1, UC_Lo}, {0xaab2, 0xaab4, UC_Mn}, {0xaab5, 0xaab6, UC_Lo},
+	{0xaab7, 0xaab8, UC_Mn}, {0xaab9, 0xaabd, UC_Lo}, {0xaabe, 0xaabf, UC_Mn},
+	{0xaac0, 0xaac0, UC_Lo}, {0xaac1, 0xaac1, UC_Mn}, {0xaac2, 0xaac2, UC_Lo},
+	{0xaadb, 0xaadc, UC_Lo}, {0xaadd, 0xaadd, UC_Lm}, {0xaade, 0xaadf, UC_Po},
+	{0xaae0, 0xaaea, UC_Lo}, {0xaaeb, 0xaaeb, UC_Mc}, {0xaaec, 0xaaed, UC_Mn},
+	{0xaaee, 0xaaef, UC_Mc}, {0xaaf0, 0xaaf1, UC_Po}, {0xaaf2, 0xaaf2, UC_Lo},
+	{0xaaf3, 0xaaf4, UC_Lm}, {0xaaf5, 0xaaf5, UC_Mc}, {0xaaf6, 0xaaf6, UC_Mn},
+	{0xab01, 0xab06, UC_Lo}, {0xab09, 0xab0e, UC_Lo}, {0xab11, 0xab16, UC_Lo},
+	{0xab20, 0xab26, UC_Lo}, {0xab28, 0xab2e, UC_Lo}, {0xab30, 0xab5a, UC_Ll},
+	{0xab5b, 0xab5b, UC_Sk}, {0xab5c, 0xab5f, UC_Lm}, {0xab60, 0xab68, UC_Ll},
+	{0xab69, 0xab69, UC_Lm}, {0xab6a, 0xab6b, UC_Sk}, {0xab70, 0xabbf, UC_Ll},
+	{0xabc0, 0xabe2, UC_Lo}, {0xabe3, 0xabe4, UC_Mc}, {0xabe5, 0xabe5, UC_Mn},
+	{0xabe6, 0xabe7, UC_Mc}, {0xabe8, 0xabe8, UC_Mn}, {0xabe9, 0xabea, UC_Mc},
+	{0xabeb, 0xabeb, UC_Po}, {0xabec, 0xabec, UC_Mc}, {0xabed, 0xabed, UC_Mn},
+	{0xabf0, 0xabf9, UC_Nd}, {0xac00, 0xd7a3, UC_Lo}, {0xd7b0, 0xd7c6, UC_Lo},
+	{0xd7cb, 0xd7fb, UC_Lo}, {0xf900, 0xfa6d, UC_Lo}, {0xfa70, 0xfad9, UC_Lo},
+	{0xfb00, 0xfb06, UC_Ll}, {0xfb13, 0xfb17, UC_Ll}, {0xfb1d, 0xfb1d, UC_Lo},
+	{0xfb1e, 0xfb1e, UC_Mn}, {0xfb1f, 0xfb28, UC_Lo}, {0xfb29, 0xfb29, UC_Sm},
+	{0xfb2a, 0xfb36, UC_Lo}, {0xfb38, 0xfb3c, UC_Lo}, {0xfb3e, 0xfb3e, UC_Lo},
+	{0xfb40, 0xfb41, UC_Lo}, {0xfb43, 0xfb44, UC_Lo}, {0xfb46, 0xfbb1, UC_Lo},
+	{0xfbb2, 0xfbc2, UC_Sk}, {0xfbd3, 0xfd3d, UC_Lo}, {0xfd3e, 0xfd3e, UC_Pe},
+	{0xfd3f, 0xfd3f, UC_Ps}, {0xfd40, 0xfd4f, UC_So}, {0xfd50, 0xfd8f, UC_Lo},
+	{0xfd92, 0xfdc7, UC_Lo}, {0xfdcf, 0xfdcf, UC_So}, {0xfdf0, 0xfdfb, UC_Lo},
+	{0xfdfc, 0xfdfc, UC_Sc}, {0xfdfd, 0xfdff, UC_So}, {0xfe00, 0xfe0f, UC_Mn},
+	{0xfe10, 0xfe16, UC_Po}, {0xfe17, 0xfe17, UC_Ps}, {0xfe18, 0xfe18, UC_Pe},
+	{0xfe19, 0xfe19, UC_Po}, {0xfe20, 0xfe2f, UC_Mn}, {0xfe30, 0xfe30, UC_Po},
+	{0xfe31, 0xfe32, UC_Pd}, {0xfe33, 0xfe34, UC_Pc}, {0xfe35, 0xfe35, UC_Ps},
+	{0xfe36, 0xfe36, UC_Pe}, {0xfe37, 0xfe37, UC_Ps}, {0xfe38, 0xfe38, UC_Pe},
+	{0xfe39, 0xfe39, UC_Ps}, {0xfe3a, 0xfe3a, UC_Pe}, {0xfe3b, 0xfe3b, UC_Ps},
+	{0xfe3c, 0xfe3c, UC_Pe}, {0xfe3d, 0xfe3d, UC_Ps}, {0xfe3e, 0xfe3e, UC_Pe},
+	{0xfe3f, 0xfe3f, UC_Ps}, {0xfe40, 0xfe40, UC_Pe}, {0xfe41, 0xfe41, UC_Ps},
+	{0xfe42, 0xfe42, UC_Pe}, {0xfe43, 0xfe43, UC_Ps}, {0xfe44, 0xfe44, UC_Pe},
+	{0xfe45, 0xfe46, UC_Po}, {0xfe47, 0xfe47, UC_Ps}, {0xfe48, 0xfe48, UC_Pe},
+	{0xfe49, 0xfe4c, UC_Po}, {0xfe4d, 0xfe4f, UC_Pc}, {0xfe50, 0xfe52, UC_Po},
+	{0xfe54, 0xfe57, UC_Po}, {0xfe58, 0xfe58, UC_Pd}, {0xfe59, 0xfe59, UC_Ps},
+	{0xfe5a, 0xfe5a, UC_Pe}, {0xfe5b, 0xfe5b, UC_Ps}, {0xfe5c, 0xfe5c, UC_Pe},
+	{0xfe5d, 0xfe5d, UC_Ps}, {0xfe5e, 0xfe5e, UC_Pe}, {0xfe5f, 0xfe61, UC_Po},
+	{0xfe62, 0xfe62, UC_Sm}, {0xfe63, 0xfe63, UC_Pd}, {0xfe64, 0xfe66, UC_Sm},
+	{0xfe68, 0xfe68, UC_Po}, {0xfe69, 0xfe69, UC_Sc}, {0xfe6a, 0xfe6b, UC_Po},
+	{0xfe70, 0xfe74, UC_Lo}, {0xfe76, 0xfefc, UC_Lo}, {0xfeff, 0xfeff, UC_Cf},
+	{0xff01, 0xff03, UC_Po}, {0xff04, 0xff04, UC_Sc}, {0xff05, 0xff07, UC_Po},
+	{0xff08, 0xff08, UC_Ps}, {0xff09, 0xff09, UC_Pe}, {0xff0a, 0xff0a, UC_Po},
+	{0xff0b, 0xff0b, UC_Sm}, {0xff0c, 0xff0c, UC_Po}, {0xff0d, 0xff0d, UC_Pd},
+	{0xff0e, 0xff0f, UC_Po}, {0xff10, 0xff19, UC_Nd}, {0xff1a, 0xff1b, UC_Po},
+	{0xff1c, 0xff1e, UC_Sm}, {0xff1f, 0xff20, UC_Po}, {0xff21, 0xff3a, UC_Lu},
+	{0xff3b, 0xff3b, UC_Ps}, {0xff3c, 0xff3c, UC_Po}, {0xff3d, 0xff3d, UC_Pe},
+	{0xff3e, 0xff3e, UC_Sk}, {0xff3f, 0xff3f, UC_Pc}, {0xff40, 0xff40, UC_Sk},
+	{0xff41, 0xff5a, UC_Ll}, {0xff5b, 0xff5b, UC_Ps}, {0xff5c, 0xff5c, UC_Sm},
+	{0xff5d, 0xff5d, UC_Pe}, {0xff5e, 0xff5e, UC_Sm}, {0xff5f, 0xff5f, UC_Ps},
+	{0xff60, 0xff60, UC_Pe}, {0xff61, 0xff61, UC_Po}, {0xff62, 0xff62, UC_Ps},
+	{0xff63, 0xff63, UC_Pe}, {0xff64, 0xff65, UC_Po}, {0xff66, 0xff6f, UC_Lo},
+	{0xff70, 0xff70, UC_Lm}, {0xff71, 0xff9d, UC_Lo}, {0xff9e, 0xff9f, UC_Lm},
+	{0xffa0, 0xffbe, UC_Lo}, {0xffc2, 0xffc7, UC_Lo}, {0xffca, 0xffcf, UC_Lo},
+	{0xffd2, 0xffd7, UC_Lo}, {0xffda, 0xffdc, UC_Lo}, {0xffe0, 0xffe1, UC_Sc},
+	{0xffe2, 0xffe2, UC_Sm}, {0xffe3, 0xffe3, UC_Sk}, {0xffe4, 0xffe4, UC_So},
+	{0xffe5, 0xffe6, UC_Sc}, {0xffe8, 0xffe8, UC_So}, {0xffe9, 0xffec, UC_Sm},
+	{0xffed, 0xffee, UC_So}, {0xfff9, 0xfffb, UC_Cf}, {0xfffc, 0xfffd, UC_So},
+	{0x10000, 0x1000b, UC_Lo}, {0x1000d, 0x10026, UC_Lo}, {0x10028, 0x1003a, UC_Lo},
+	{0x1003c, 0x1003d, UC_Lo}, {0x1003f, 0x1004d, UC_Lo}, {0x10050, 0x1005d, UC_Lo},
+	{0x10080, 0x100fa, UC_Lo}, {0x10100, 0x10102, UC_Po}, {0x10107, 0x10133, UC_No},
+	{0x10137, 0x1013f, UC_So}, {0x10140, 0x10174, UC_Nl}, {0x10175, 0x10178, UC_No},
+	{0x10179, 0x10189, UC_So}, {0x1018a, 0x1018b, UC_No}, {0x1018c, 0x1018e, UC_So},
+	{0x10190, 0x1019c, UC_So}, {0x101a0, 0x101a0, UC_So}, {0x101d0, 0x101fc, UC_So},
+	{0x101fd, 0x101fd, UC_Mn}, {0x10280, 0x1029c, UC_Lo}, {0x102a0, 0x102d0, UC_Lo},
+	{0x102e0, 0x102e0, UC_Mn}, {0x102e1, 0x102fb, UC_No}, {0x10300, 0x1031f, UC_Lo},
+	{0x10320, 0x10323, UC_No}, {0x1032d, 0x10340, UC_Lo}, {0x10341, 0x10341, UC_Nl},
+	{0x10342, 0x10349, UC_Lo}, {0x1034a, 0x1034a, UC_Nl}, {0x10350, 0x10375, UC_Lo},
+	{0x10376, 0x1037a, UC_Mn}, {0x10380, 0x1039d, UC_Lo}, {0x1039f, 0x1039f, UC_Po},
+	{0x103a0, 0x103c3, UC_Lo}, {0x103c8, 0x103cf, UC_Lo}, {0x103d0, 0x103d0, UC_Po},
+	{0x103d1, 0x103d5, UC_Nl}, {0x10400, 0x10427, UC_Lu}, {0x10428, 0x1044f, UC_Ll},
+	{0x10450, 0x1049d, UC_Lo}, {0x104a0, 0x104a9, UC_Nd}, {0x104b0, 0x104d3, UC_Lu},
+	{0x104d8, 0x104fb, UC_Ll}, {0x10500, 0x10527, UC_Lo}, {0x10530, 0x10563, UC_Lo},
+	{0x1056f, 0x1056f, UC_Po}, {0x10570, 0x1057a, UC_Lu}, {0x1057c, 0x1058a, UC_Lu},
+	{0x1058c, 0x10592, UC_Lu}, {0x10594, 0x10595, UC_Lu}, {0x10597, 0x105a1, UC_Ll},
+	{0x105a3, 0x105b1, UC_Ll}, {0x105b3, 0x105b9, UC_Ll}, {0x105bb, 0x105bc, UC_Ll},
+	{0x10600, 0x10736, UC_Lo}, {0x10740, 0x10755, UC_Lo}, {0x10760, 0x10767, UC_Lo},
+	{0x10780, 0x10785, UC_Lm}, {0x10787, 0x107b0, UC_Lm}, {0x107b2, 0x107ba, UC_Lm},
+	{0x10800, 0x10805, UC_Lo}, {0x10808, 0x10808, UC_Lo}, {0x1080a, 0x10835, UC_Lo},
+	{0x10837, 0x10838, UC_Lo}, {0x1083c, 0x1083c, UC_Lo}, {0x1083f, 0x10855, UC_Lo},
+	{0x10857, 0x10857, UC_Po}, {0x10858, 0x1085f, UC_No}, {0x10860, 0x10876, UC_Lo},
+	{0x10877, 0x10878, UC_So}, {0x10879, 0x1087f, UC_No}, {0x10880, 0x1089e, UC_Lo},
+	{0x108a7, 0x108af, UC_No}, {0x108e0, 0x108f2, UC_Lo}, {0x108f4, 0x108f5, UC_Lo},
+	{0x108fb, 0x108ff, UC_No}, {0x10900, 0x10915, UC_Lo}, {0x10916, 0x1091b, UC_No},
+	{0x1091f, 0x1091f, UC_Po}, {0x10920, 0x10939, UC_Lo}, {0x1093f, 0x1093f, UC_Po},
+	{0x10980, 0x109b7, UC_Lo}, {0x109bc, 0x109bd, UC_No}, {0x109be, 0x109bf, UC_Lo},
+	{0x109c0, 0x109cf, UC_No}, {0x109d2, 0x109ff, UC_No}, {0x10a00, 0x10a00, UC_Lo},
+	{0x10a01, 0x10a03, UC_Mn}, {0x10a05, 0x10a06, UC_Mn}, {0x10a0c, 0x10a0f, UC_Mn},
+	{0x10a10, 0x10a13, UC_Lo}, {0x10a15, 0x10a17, UC_Lo}, {0x10a19, 0x10a35, UC_Lo},
+	{0x10a38, 0x10a3a, UC_Mn}, {0x10a3f, 0x10a3f, UC_Mn}, {0x10a40, 0x10a48, UC_No},
+	{0x10a50, 0x10a58, UC_Po}, {0x10a60, 0x10a7c, UC_Lo}, {0x10a7d, 0x10a7e, UC_No},
+	{0x10a7f, 0x10a7f, UC_Po}, {0x10a80, 0x10a9c, UC_Lo}, {0x10a9d, 0x10a9f, UC_No},
+	{0x10ac0, 0x10ac7, UC_Lo}, {0x10ac8, 0x10ac8, UC_So}, {0x10ac9, 0x10ae4, UC_Lo},
+	{0x10ae5, 0x10ae6, UC_Mn}, {0x10aeb, 0x10aef, UC_No}, {0x10af0, 0x10af6, UC_Po},
+	{0x10b00, 0x10b35, UC_Lo}, {0x10b39, 0x10b3f, UC_Po}, {0x10b40, 0x10b55, UC_Lo},
+	{0x10b58, 0x10b5f, UC_No}, {0x10b60, 0x10b72, UC_Lo}, {0x10b78, 0x10b7f, UC_No},
+	{0x10b80, 0x10b91, UC_Lo}, {0x10b99, 0x10b9c, UC_Po}, {0x10ba9, 0x10baf, UC_No},
+	{0x10c00, 0x10c48, UC_Lo}, {0x10c80, 0x10cb2, UC_Lu}, {0x10cc0, 0x10cf2, UC_Ll},
+	{0x10cfa, 0x10cff, UC_No}, {0x10d00, 0x10d23, UC_Lo}, {0x10d24, 0x10d27, UC_Mn},
+	{0x10d30, 0x10d39, UC_Nd}, {0x10e60, 0x10e7e, UC_No}, {0x10e80, 0x10ea9, UC_Lo},
+	{0x10eab, 0x10eac, UC_Mn}, {0x10ead, 0x10ead, UC_Pd}, {0x10eb0, 0x10eb1, UC_Lo},
+	{0x10f00, 0x10f1c, UC_Lo}, {0x10f1d, 0x10f26, UC_No}, {0x10f27, 0x10f27, UC_Lo},
+	{0x10f30, 0x10f45, UC_Lo}, {0x10f46, 0x10f50, UC_Mn}, {0x10f51, 0x10f54, UC_No},
+	{0x10f55, 0x10f59, UC_Po}, {0x10f70, 0x10f81, UC_Lo}, {0x10f82, 0x10f85, UC_Mn},
+	{0x10f86, 0x10f89, UC_Po}, {0x10fb0, 0x10fc4, UC_Lo}, {0x10fc5, 0x10fcb, UC_No},
+	{0x10fe0, 0x10ff6, UC_Lo}, {0x11000, 0x11000, UC_Mc}, {0x11001, 0x11001, UC_Mn},
+	{0x11002, 0x11002, UC_Mc}, {0x11003, 0x11037, UC_Lo}, {0x11038, 0x11046, UC_Mn},
+	{0x11047, 0x1104d, UC_Po}, {0x11052, 0x11065, UC_No}, {0x11066, 0x1106f, UC_Nd},
+	{0x11070, 0x11070, UC_Mn}, {0x11071, 0x11072, UC_Lo}, {0x11073, 0x11074, UC_Mn},
+	{0x11075, 0x11075, UC_Lo}, {0x1107f, 0x11081, UC_Mn}, {0x11082, 0x11082, UC_Mc},
+	{0x11083, 0x110af, UC_Lo}, {0x110b0, 0x110b2, UC_Mc}, {0x110b3, 0x110b6, UC_Mn},
+	{0x110b7, 0x110b8, UC_Mc}, {0x110b9, 0x110ba, UC_Mn}, {0x110bb, 0x110bc, UC_Po},
+	{0x110bd, 0x110bd, UC_Cf}, {0x110be, 0x110c1, UC_Po}, {0x110c2, 0x110c2, UC_Mn},
+	{0x110cd, 0x110cd, UC_Cf}, {0x110d0, 0x110e8, UC_Lo}, {0x110f0, 0x110f9, UC_Nd},
+	{0x11100, 0x11102, UC_Mn}, {0x11103, 0x11126, UC_Lo}, {0x11127, 0x1112b, UC_Mn},
+	{0x1112c, 0x1112c, UC_Mc}, {0x1112d, 0x11134, UC_Mn}, {0x11136, 0x1113f, UC_Nd},
+	{0x11140, 0x11143, UC_Po}, {0x11144, 0x11144, UC_Lo}, {0x11145, 0x11146, UC_Mc},
+	{0x11147, 0x11147, UC_Lo}, {0x11150, 0x11172, UC_Lo}, {0x11173, 0x11173, UC_Mn},
+	{0x11174, 0x11175, UC_Po}, {0x11176, 0x11176, UC_Lo}, {0x11180, 0x11181, UC_Mn},
+	{0x11182, 0x11182, UC_Mc}, {0x11183, 0x111b2, UC_Lo}, {0x111b3, 0x111b5, UC_Mc},
+	{0x111b6, 0x111be, UC_Mn}, {0x111bf, 0x111c0, UC_Mc}, {0x111c1, 0x111c4, UC_Lo},
+	{0x111c5, 0x111c8, UC_Po}, {0x111c9, 0x111cc, UC_Mn}, {0x111cd, 0x111cd, UC_Po},
+	{0x111ce, 0x111ce, UC_Mc}, {0x111cf, 0x111cf, UC_Mn}, {0x111d0, 0x111d9, UC_Nd},
+	{0x111da, 0x111da, UC_Lo}, {0x111db, 0x111db, UC_Po}, {0x111dc, 0x111dc, UC_Lo},
+	{0x111dd, 0x111df, UC_Po}, {0x111e1, 0x111f4, UC_No}, {0x11200, 0x11211, UC_Lo},
+	{0x11213, 0x1122b, UC_Lo}, {0x1122c, 0x1122e, UC_Mc}, {0x1122f, 0x11231, UC_Mn},
+	{0x11232, 0x11233, UC_Mc}, {0x11234, 0x11234, UC_Mn}, {0x11235, 0x11235, UC_Mc},
+	{0x11236, 0x11237, UC_Mn}, {0x11238, 0x1123d, UC_Po}, {0x1123e, 0x1123e, UC_Mn},
+	{0x11280, 0x11286, UC_Lo}, {0x11288, 0x11288, UC_Lo}, {0x1128a, 0x1128d, UC_Lo},
+	{0x1128f, 0x1129d, UC_Lo}, {0x1129f, 0x112a8, UC_Lo}, {0x112a9, 0x112a9, UC_Po},
+	{0x112b0, 0x112de, UC_Lo}, {0x112df, 0x112df, UC_Mn}, {0x112e0, 0x112e2, UC_Mc},
+	{0x112e3, 0x112ea, UC_Mn}, {0x112f0, 0x112f9, UC_Nd}, {0x11300, 0x11301, UC_Mn},
+	{0x11302, 0x11303, UC_Mc}, {0x11305, 0x1130c, UC_Lo}, {0x1130f, 0x11310, UC_Lo},
+	{0x11313, 0x11328, UC_Lo}, {0x1132a, 0x11330, UC_Lo}, {0x11332, 0x11333, UC_Lo},
+	{0x11335, 0x11339, UC_Lo}, {0x1133b, 0x1133c, UC_Mn}, {0x1133d, 0x1133d, UC_Lo},
+	{0x1133e, 0x1133f, UC_Mc}, {0x11340, 0x11340, UC_Mn}, {0x11341, 0x11344, UC_Mc},
+	{0x11347, 0x11348, UC_Mc}, {0x1134b, 0x1134d, UC_Mc}, {0x11350, 0x11350, UC_Lo},
+	{0x11357, 0x11357, UC_Mc}, {0x1135d, 0x11361, UC_Lo}, {0x11362, 0x11363, UC_Mc},
+	{0x11366, 0x1136c, UC_Mn}, {0x11370, 0x11374, UC_Mn}, {0x11400, 0x11434, UC_Lo},
+	{0x11435, 0x11437, UC_Mc}, {0x11438, 0x1143f, UC_Mn}, {0x11440, 0x11441, UC_Mc},
+	{0x11442, 0x11444, UC_Mn}, {0x11445, 0x11445, UC_Mc}, {0x11446, 0x11446, UC_Mn},
+	{0x11447, 0x1144a, UC_Lo}, {0x1144b, 0x1144f, UC_Po}, {0x11450, 0x11459, UC_Nd},
+	{0x1145a, 0x1145b, UC_Po}, {0x1145d, 0x1145d, UC_Po}, {0x1145e, 0x1145e, UC_Mn},
+	{0x1145f, 0x11461, UC_Lo}, {0x11480, 0x114af, UC_Lo}, {0x114b0, 0x114b2, UC_Mc},
+	{0x114b3, 0x114b8, UC_Mn}, {0x114b9, 0x114b9, UC_Mc}, {0x114ba, 0x114ba, UC_Mn},
+	{0x114bb, 0x114be, UC_Mc}, {0x114bf, 0x114c0, UC_Mn}, {0x114c1, 0x114c1, UC_Mc},
+	{0x114c2, 0x114c3, UC_Mn}, {0x114c4, 0x114c5, UC_Lo}, {0x114c6, 0x114c6, UC_Po},
+	{0x114c7, 0x114c7, UC_Lo}, {0x114d0, 0x114d9, UC_Nd}, {0x11580, 0x115ae, UC_Lo},
+	{0x115af, 0x115b1, UC_Mc}, {0x115b2, 0x115b5, UC_Mn}, {0x115b8, 0x115bb, UC_Mc},
+	{0x115bc, 0x115bd, UC_Mn}, {0x115be, 0x115be, UC_Mc}, {0x115bf, 0x115c0, UC_Mn},
+	{0x115c1, 0x115d7, UC_Po}, {0x115d8, 0x115db, UC_Lo}, {0x115dc, 0x115dd, UC_Mn},
+	{0x11600, 0x1162f, UC_Lo}, {0x11630, 0x11632, UC_Mc}, {0x11633, 0x1163a, UC_Mn},
+	{0x1163b, 0x1163c, UC_Mc}, {0x1163d, 0x1163d, UC_Mn}, {0x1163e, 0x1163e, UC_Mc},
+	{0x1163f, 0x11640, UC_Mn}, {0x11641, 0x11643, UC_Po}, {0x11644, 0x11644, UC_Lo},
+	{0x11650, 0x11659, UC_Nd}, {0x11660, 0x1166c, UC_Po}, {0x11680, 0x116aa, UC_Lo},
+	{0x116ab, 0x116ab, UC_Mn}, {0x116ac, 0x116ac, UC_Mc}, {0x116ad, 0x116ad, UC_Mn},
+	{0x116ae, 0x116af, UC_Mc}, {0x116b0, 0x116b5, UC_Mn}, {0x116b6, 0x116b6, UC_Mc},
+	{0x116b7, 0x116b7, UC_Mn}, {0x116b8, 0x116b8, UC_Lo}, {0x116b9, 0x116b9, UC_Po},
+	{0x116c0, 0x116c9, UC_Nd}, {0x11700, 0x1171a, UC_Lo}, {0x1171d, 0x1171f, UC_Mn},
+	{0x11720, 0x11721, UC_Mc}, {0x11722, 0x11725, UC_Mn}, {0x11726, 0x11726, UC_Mc},
+	{0x11727, 0x1172b, UC_Mn}, {0x11730, 0x11739, UC_Nd}, {0x1173a, 0x1173b, UC_No},
+	{0x1173c, 0x1173e, UC_Po}, {0x1173f, 0x1173f, UC_So}, {0x11740, 0x11746, UC_Lo},
+	{0x11800, 0x1182b, UC_Lo}, {0x1182c, 0x1182e, UC_Mc}, {0x1182f, 0x11837, UC_Mn},
+	{0x11838, 0x11838, UC_Mc}, {0x11839, 0x1183a, UC_Mn}, {0x1183b, 0x1183b, UC_Po},
+	{0x118a0, 0x118bf, UC_Lu}, {0x118c0, 0x118df, UC_Ll}, {0x118e0, 0x118e9, UC_Nd},
+	{0x118ea, 0x118f2, UC_No}, {0x118ff, 0x11906, UC_Lo}, {0x11909, 0x11909, UC_Lo},
+	{0x1190c, 0x11913, UC_Lo}, {0x11915, 0x11916, UC_Lo}, {0x11918, 0x1192f, UC_Lo},
+	{0x11930, 0x11935, UC_Mc}, {0x11937, 0x11938, UC_Mc}, {0x1193b, 0x1193c, UC_Mn},
+	{0x1193d, 0x1193d, UC_Mc}, {0x1193e, 0x1193e, UC_Mn}, {0x1193f, 0x1193f, UC_Lo},
+	{0x11940, 0x11940, UC_Mc}, {0x11941, 0x11941, UC_Lo}, {0x11942, 0x11942, UC_Mc},
+	{0x11943, 0x11943, UC_Mn}, {0x11944, 0x11946, UC_Po}, {0x11950, 0x11959, UC_Nd},
+	{0x119a0, 0x119a7, UC_Lo}, {0x119aa, 0x119d0, UC_Lo}, {0x119d1, 0x119d3, UC_Mc},
+	{0x119d4, 0x119d7, UC_Mn}, {0x119da, 0x119db, UC_Mn}, {0x119dc, 0x119df, UC_Mc},
+	{0x119e0, 0x119e0, UC_Mn}, {0x119e1, 0x119e1, UC_Lo}, {0x119e2, 0x119e2, UC_Po},
+	{0x119e3, 0x119e3, UC_Lo}, {0x119e4, 0x119e4, UC_Mc}, {0x11a00, 0x11a00, UC_Lo},
+	{0x11a01, 0x11a0a, UC_Mn}, {0x11a0b, 0x11a32, UC_Lo}, {0x11a33, 0x11a38, UC_Mn},
+	{0x11a39, 0x11a39, UC_Mc}, {0x11a3a, 0x11a3a, UC_Lo}, {0x11a3b, 0x11a3e, UC_Mn},
+	{0x11a3f, 0x11a46, UC_Po}, {0x11a47, 0x11a47, UC_Mn}, {0x11a50, 0x11a50, UC_Lo},
+	{0x11a51, 0x11a56, UC_Mn}, {0x11a57, 0x11a58, UC_Mc}, {0x11a59, 0x11a5b, UC_Mn},
+	{0x11a5c, 0x11a89, UC_Lo}, {0x11a8a, 0x11a96, UC_Mn}, {0x11a97, 0x11a97, UC_Mc},
+	{0x11a98, 0x11a99, UC_Mn}, {0x11a9a, 0x11a9c, UC_Po}, {0x11a9d, 0x11a9d, UC_Lo},
+	{0x11a9e, 0x11aa2, UC_Po}, {0x11ab0, 0x11af8, UC_Lo}, {0x11c00, 0x11c08, UC_Lo},
+	{0x11c0a, 0x11c2e, UC_Lo}, {0x11c2f, 0x11c2f, UC_Mc}, {0x11c30, 0x11c36, UC_Mn},
+	{0x11c38, 0x11c3d, UC_Mn}, {0x11c3e, 0x11c3e, UC_Mc}, {0x11c3f, 0x11c3f, UC_Mn},
+	{0x11c40, 0x11c40, UC_Lo}, {0x11c41, 0x11c45, UC_Po}, {0x11c50, 0x11c59, UC_Nd},
+	{0x11c5a, 0x11c6c, UC_No}, {0x11c70, 0x11c71, UC_Po}, {0x11c72, 0x11c8f, UC_Lo},
+	{0x11c92, 0x11ca7, UC_Mn}, {0x11ca9, 0x11ca9, UC_Mc}, {0x11caa, 0x11cb0, UC_Mn},
+	{0x11cb1, 0x11cb1, UC_Mc}, {0x11cb2, 0x11cb3, UC_Mn}, {0x11cb4, 0x11cb4, UC_Mc},
+	{0x11cb5, 0x11cb6, UC_Mn}, {0x11d00, 0x11d06, UC_Lo}, {0x11d08, 0x11d09, UC_Lo},
+	{0x11d0b, 0x11d30, UC_Lo}, {0x11d31, 0x11d36, UC_Mn}, {0x11d3a, 0x11d3a, UC_Mn},
+	{0x11d3c, 0x11d3d, UC_Mn}, {0x11d3f, 0x11d45, UC_Mn}, {0x11d46, 0x11d46, UC_Lo},
+	{0x11d47, 0x11d47, UC_Mn}, {0x11d50, 0x11d59, UC_Nd}, {0x11d60, 0x11d65, UC_Lo},
+	{0x11d67, 0x11d68, UC_Lo}, {0x11d6a, 0x11d89, UC_Lo}, {0x11d8a, 0x11d8e, UC_Mc},
+	{0x11d90, 0x11d91, UC_Mn}, {0x11d93, 0x11d94, UC_Mc}, {0x11d95, 0x11d95, UC_Mn},
+	{0x11d96, 0x11d96, UC_Mc}, {0x11d97, 0x11d97, UC_Mn}, {0x11d98, 0x11d98, UC_Lo},
+	{0x11da0, 0x11da9, UC_Nd}, {0x11ee0, 0x11ef2, UC_Lo}, {0x11ef3, 0x11ef4, UC_Mn},
+	{0x11ef5, 0x11ef6, UC_Mc}, {0x11ef7, 0x11ef8, UC_Po}, {0x11fb0, 0x11fb0, UC_Lo},
+	{0x11fc0, 0x11fd4, UC_No}, {0x11fd5, 0x11fdc, UC_So}, {0x11fdd, 0x11fe0, UC_Sc},
+	{0x11fe1, 0x11ff1, UC_So}, {0x11fff, 0x11fff, UC_Po}, {0x12000, 0x12399, UC_Lo},
+	{0x12400, 0x1246e, UC_Nl}, {0x12470, 0x12474, UC_Po}, {0x12480, 0x12543, UC_Lo},
+	{0x12f90, 0x12ff0, UC_Lo}, {0x12ff1, 0x12ff2, UC_Po}, {0x13000, 0x1342e, UC_Lo},
+	{0x13430, 0x13438, UC_Cf}, {0x14400, 0x14646, UC_Lo}, {0x16800, 0x16a38, UC_Lo},
+	{0x16a40, 0x16a5e, UC_Lo}, {0x16a60, 0x16a69, UC_Nd}, {0x16a6e, 0x16a6f, UC_Po},
+	{0x16a70, 0x16abe, UC_Lo}, {0x16ac0, 0x16ac9, UC_Nd}, {0x16ad0, 0x16aed, UC_Lo},
+	{0x16af0, 0x16af4, UC_Mn}, {0x16af5, 0x16af5, UC_Po}, {0x16b00, 0x16b2f, UC_Lo},
+	{0x16b30, 0x16b36, UC_Mn}, {0x16b37, 0x16b3b, UC_Po}, {0x16b3c, 0x16b3f, UC_So},
+	{0x16b40, 0x16b43, UC_Lm}, {0x16b44, 0x16b44, UC_Po}, {0x16b45, 0x16b45, UC_So},
+	{0x16b50, 0x16b59, UC_Nd}, {0x16b5b, 0x16b61, UC_No}, {0x16b63, 0x16b77, UC_Lo},
+	{0x16b7d, 0x16b8f, UC_Lo}, {0x16e40, 0x16e5f, UC_Lu}, {0x16e60, 0x16e7f, UC_Ll},
+	{0x16e80, 0x16e96, UC_No}, {0x16e97, 0x16e9a, UC_Po}, {0x16f00, 0x16f4a, UC_Lo},
+	{0x16f4f, 0x16f4f, UC_Mn}, {0x16f50, 0x16f50, UC_Lo}, {0x16f51, 0x16f87, UC_Mc},
+	{0x16f8f, 0x16f92, UC_Mn}, {0x16f93, 0x16f9f, UC_Lm}, {0x16fe0, 0x16fe1, UC_Lm},
+	{0x16fe2, 0x16fe2, UC_Po}, {0x16fe3, 0x16fe3, UC_Lm}, {0x16fe4, 0x16fe4, UC_Mn},
+	{0x16ff0, 0x16ff1, UC_Mc}, {0x17000, 0x187f7, UC_Lo}, {0x18800, 0x18cd5, UC_Lo},
+	{0x18d00, 0x18d08, UC_Lo}, {0x1aff0, 0x1aff3, UC_Lm}, {0x1aff5, 0x1affb, UC_Lm},
+	{0x1affd, 0x1affe, UC_Lm}, {0x1b000, 0x1b122, UC_Lo}, {0x1b150, 0x1b152, UC_Lo},
+	{0x1b164, 0x1b167, UC_Lo}, {0x1b170, 0x1b2fb, UC_Lo}, {0x1bc00, 0x1bc6a, UC_Lo},
+	{0x1bc70, 0x1bc7c, UC_Lo}, {0x1bc80, 0x1bc88, UC_Lo}, {0x1bc90, 0x1bc99, UC_Lo},
+	{0x1bc9c, 0x1bc9c, UC_So}, {0x1bc9d, 0x1bc9e, UC_Mn}, {0x1bc9f, 0x1bc9f, UC_Po},
+	{0x1bca0, 0x1bca3, UC_Cf}, {0x1cf00, 0x1cf2d, UC_Mn}, {0x1cf30, 0x1cf46, UC_Mn},
+	{0x1cf50, 0x1cfc3, UC_So}, {0x1d000, 0x1d0f5, UC_So}, {0x1d100, 0x1d126, UC_So},
+	{0x1d129, 0x1d164, UC_So}, {0x1d165, 0x1d166, UC_Mc}, {0x1d167, 0x1d169, UC_Mn},
+	{0x1d16a, 0x1d16c, UC_So}, {0x1d16d, 0x1d172, UC_Mc}, {0x1d173, 0x1d17a, UC_Cf},
+	{0x1d17b, 0x1d182, UC_Mn}, {0x1d183, 0x1d184, UC_So}, {0x1d185, 0x1d18b, UC_Mn},
+	{0x1d18c, 0x1d1a9, UC_So}, {0x1d1aa, 0x1d1ad, UC_Mn}, {0x1d1ae, 0x1d1ea, UC_So},
+	{0x1d200, 0x1d241, UC_So}, {0x1d242, 0x1d244, UC_Mn}, {0x1d245, 0x1d245, UC_So},
+	{0x1d2e0, 0x1d2f3, UC_No}, {0x1d300, 0x1d356, UC_So}, {0x1d360, 0x1d378, UC_No},
+	{0x1d400, 0x1d419, UC_Lu}, {0x1d41a, 0x1d433, UC_Ll}, {0x1d434, 0x1d44d, UC_Lu},
+	{0x1d44e, 0x1d454, UC_Ll}, {0x1d456, 0x1d467, UC_Ll}, {0x1d468, 0x1d481, UC_Lu},
+	{0x1d482, 0x1d49b, UC_Ll}, {0x1d49c, 0x1d49c, UC_Lu}, {0x1d49e, 0x1d49f, UC_Lu},
+	{0x1d4a2, 0x1d4a2, UC_Lu}, {0x1d4a5, 0x1d4a6, UC_Lu}, {0x1d4a9, 0x1d4ac, UC_Lu},
+	{0x1d4ae, 0x1d4b5, UC_Lu}, {0x1d4b6, 0x1d4b9, UC_Ll}, {0x1d4bb, 0x1d4bb, UC_Ll},
+	{0x1d4bd, 0x1d4c3, UC_Ll}, {0x1d4c5, 0x1d4cf, UC_Ll}, {0x1d4d0, 0x1d4e9, UC_Lu},
+	{0x1d4ea, 0x1d503, UC_Ll}, {0x1d504, 0x1d505, UC_Lu}, {0x1d507, 0x1d50a, UC_Lu},
+	{0x1d50d, 0x1d514, UC_Lu}, {0x1d516, 0x1d51c, UC_Lu}, {0x1d51e, 0x1d537, UC_Ll},
+	{0x1d538, 0x1d539, UC_Lu}, {0x1d53b, 0x1d53e, UC_Lu}, {0x1d540, 0x1d544, UC_Lu},
+	{0x1d546, 0x1d546, UC_Lu}, {0x1d54a, 0x1d550, UC_Lu}, {0x1d552, 0x1d56b, UC_Ll},
+	{0x1d56c, 0x1d585, UC_Lu}, {0x1d586, 0x1d59f, UC_Ll}, {0x1d5a0, 0x1d5b9, UC_Lu},
+	{0x1d5ba, 0x1d5d3, UC_Ll}, {0x1d5d4, 0x1d5ed, UC_Lu}, {0x1d5ee, 0x1d607, UC_Ll},
+	{0x1d608, 0x1d621, UC_Lu}, {0x1d622, 0x1d63b, UC_Ll}, {0x1d63c, 0x1d655, UC_Lu},
+	{0x1d656, 0x1d66f, UC_Ll}, {0x1d670, 0x1d689, UC_Lu}, {0x1d68a, 0x1d6a5, UC_Ll},
+	{0x1d6a8, 0x1d6c0, UC_Lu}, {0x1d6c1, 0x1d6c1, UC_Sm}, {0x1d6c2, 0x1d6da, UC_Ll},
+	{0x1d6db, 0x1d6db, UC_Sm}, {0x1d6dc, 0x1d6e1, UC_Ll}, {0x1d6e2, 0x1d6fa, UC_Lu},
+	{0x1d6fb, 0x1d6fb, UC_Sm}, {0x1d6fc, 0x1d714, UC_Ll}, {0x1d715, 0x1d715, UC_Sm},
+	{0x1d716, 0x1d71b, UC_Ll}, {0x1d71c, 0x1d734, UC_Lu}, {0x1d735, 0x1d735, UC_Sm},
+	{0x1d736, 0x1d74e, UC_Ll}, {0x1d74f, 0x1d74f, UC_Sm}, {0x1d750, 0x1d755, UC_Ll},
+	{0x1d756, 0x1d76e, UC_Lu}, {0x1d76f, 0x1d76f, UC_Sm}, {0x1d770, 0x1d788, UC_Ll},
+	{0x1d789, 0x1d789, UC_Sm}, {0x1d78a, 0x1d78f, UC_Ll}, {0x1d790, 0x1d7a8, UC_Lu},
+	{0x1d7a9, 0x1d7a9, UC_Sm}, {0x1d7aa, 0x1d7c2, UC_Ll}, {0x1d7c3, 0x1d7c3, UC_Sm},
+	{0x1d7c4, 0x1d7c9, UC_Ll}, {0x1d7ca, 0x1d7ca, UC_Lu}, {0x1d7cb, 0x1d7cb, UC_Ll},
+	{0x1d7ce, 0x1d7ff, UC_Nd}, {0x1d800, 0x1d9ff, UC_So}, {0x1da00, 0x1da36, UC_Mn},
+	{0x1da37, 0x1da3a, UC_So}, {0x1da3b, 0x1da6c, UC_Mn}, {0x1da6d, 0x1da74, UC_So},
+	{0x1da75, 0x1da75, UC_Mn}, {0x1da76, 0x1da83, UC_So}, {0x1da84, 0x1da84, UC_Mn},
+	{0x1da85, 0x1da86, UC_So}, {0x1da87, 0x1da8b, UC_Po}, {0x1da9b, 0x1da9f, UC_Mn},
+	{0x1daa1, 0x1daaf, UC_Mn}, {0x1df00, 0x1df09, UC_Ll}, {0x1df0a, 0x1df0a, UC_Lo},
+	{0x1df0b, 0x1df1e, UC_Ll}, {0x1e000, 0x1e006, UC_Mn}, {0x1e008, 0x1e018, UC_Mn},
+	{0x1e01b, 0x1e021, UC_Mn}, {0x1e023, 0x1e024, UC_Mn}, {0x1e026, 0x1e02a, UC_Mn},
+	{0x1e100, 0x1e12c, UC_Lo}, {0x1e130, 0x1e136, UC_Mn}, {0x1e137, 0x1e13d, UC_Lm},
+	{0x1e140, 0x1e149, UC_Nd}, {0x1e14e, 0x1e14e, UC_Lo}, {0x1e14f, 0x1e14f, UC_So},
+	{0x1e290, 0x1e2ad, UC_Lo}, {0x1e2ae, 0x1e2ae, UC_Mn}, {0x1e2c0, 0x1e2eb, UC_Lo},
+	{0x1e2ec, 0x1e2ef, UC_Mn}, {0x1e2f0, 0x1e2f9, UC_Nd}, {0x1e2ff, 0x1e2ff, UC_Sc},
+	{0x1e7e0, 0x1e7e6, UC_Lo}, {0x1e7e8, 0x1e7eb, UC_Lo}, {0x1e7ed, 0x1e7ee, UC_Lo},
+	{0x1e7f0, 0x1e7fe, UC_Lo}, {0x1e800, 0x1e8c4, UC_Lo}, {0x1e8c7, 0x1e8cf, UC_No},
+	{0x1e8d0, 0x1e8d6, UC_Mn}, {0x1e900, 0x1e921, UC_Lu}, {0x1e922, 0x1e943, UC_Ll},
+	{0x1e944, 0x1e94a, UC_Mn}, {0x1e94b, 0x1e94b, UC_Lm}, {0x1e950, 0x1e959, UC_Nd},
+	{0x1e95e, 0x1e95f, UC_Po}, {0x1ec71, 0x1ecab, UC_No}, {0x1ecac, 0x1ecac, UC_So},
+	{0x1ecad, 0x1ecaf, UC_No}, {0x1ecb0, 0x1ecb0, UC_Sc}, {0x1ecb1, 0x1ecb4, UC_No},
+	{0x1ed01, 0x1ed2d, UC_No}, {0x1ed2e, 0x1ed2e, UC_So}, {0x1ed2f, 0x1ed3d, UC_No},
+	{0x1ee00, 0x1ee03, UC_Lo}, {0x1ee05, 0x1ee1f, UC_Lo}, {0x1ee21, 0x1ee22, UC_Lo},
+	{0x1ee24, 0x1ee24, UC_Lo}, {0x1ee27, 0x1ee27, UC_Lo}, {0x1ee29, 0x1ee32, UC_Lo},
+	{0x1ee34, 0x1ee37, UC_Lo}, {0x1ee39, 0x1ee39, UC_Lo}, {0x1ee3b, 0x1ee3b, UC_Lo},
+	{0x1ee42, 0x1ee42, UC_Lo}, {0x1ee47, 0x1ee47, UC_Lo}, {0x1ee49, 0x1ee49, UC_Lo},
+	{0x1ee4b, 0x1ee4b, UC_Lo}, {0x1ee4d, 0x1ee4f, UC_Lo}, {0x1ee51, 0x1ee52, UC_Lo},
+	{0x1ee54, 0x1ee54, UC_Lo}, {0x1ee57, 0x1ee57, UC_Lo}, {0x1ee59, 0x1ee59, UC_Lo},
+	{0x1ee5b, 0x1ee5b, UC_Lo}, {0x1ee5d, 0x1ee5d, UC_Lo}, {0x1ee5f, 0x1ee5f, UC_Lo},
+	{0x1ee61, 0x1ee62, UC_Lo}, {0x1ee64, 0x1ee64, UC_Lo}, {0x1ee67, 0x1ee6a, UC_Lo},
+	{0x1ee6c, 0x1ee72, UC_Lo}, {0x1ee74, 0x1ee77, UC_Lo}, {0x1ee79, 0x1ee7c, UC_Lo},
+	{0x1ee7e, 0x1ee7e, UC_Lo}, {0x1ee80, 0x1ee89, UC_Lo}, {0x1ee8b, 0x1ee9b, UC_Lo},
+	{0x1eea1, 0x1eea3, UC_Lo}, {0x1eea5, 0x1eea9, UC_Lo}, {0x1eeab, 0x1eebb, UC_Lo},
+	{0x1eef0, 0x1eef1, UC_Sm}, {0x1f000, 0x1f02b, UC_So}, {0x1f030, 0x1f093, UC_So},
+	{0x1f0a0, 0x1f0ae, UC_So}, {0x1f0b1, 0x1f0bf, UC_So}, {0x1f0c1, 0x1f0cf, UC_So},
+	{0x1f0d1, 0x1f0f5, UC_So}, {0x1f100, 0x1f10c, UC_No}, {0x1f10d, 0x1f1ad, UC_So},
+	{0x1f1e6, 0x1f202, UC_So}, {0x1f210, 0x1f23b, UC_So}, {0x1f240, 0x1f248, UC_So},
+	{0x1f250, 0x1f251, UC_So}, {0x1f260, 0x1f265, UC_So}, {0x1f300, 0x1f3fa, UC_So},
+	{0x1f3fb, 0x1f3ff, UC_Sk}, {0x1f400, 0x1f6d7, UC_So}, {0x1f6dd, 0x1f6ec, UC_So},
+	{0x1f6f0, 0x1f6fc, UC_So}, {0x1f700, 0x1f773, UC_So}, {0x1f780, 0x1f7d8, UC_So},
+	{0x1f7e0, 0x1f7eb, UC_So}, {0x1f7f0, 0x1f7f0, UC_So}, {0x1f800, 0x1f80b, UC_So},
+	{0x1f810, 0x1f847, UC_So}, {0x1f850, 0x1f859, UC_So}, {0x1f860, 0x1f887, UC_So},
+	{0x1f890, 0x1f8ad, UC_So}, {0x1f8b0, 0x1f8b1, UC_So}, {0x1f900, 0x1fa53, UC_So},
+	{0x1fa60, 0x1fa6d, UC_So}, {0x1fa70, 0x1fa74, UC_So}, {0x1fa78, 0x1fa7c, UC_So},
+	{0x1fa80, 0x1fa86, UC_So}, {0x1fa90, 0x1faac, UC_So}, {0x1fab0, 0x1faba, UC_So},
+	{0x1fac0, 0x1fac5, UC_So}, {0x1fad0, 0x1fad9, UC_So}, {0x1fae0, 0x1fae7, UC_So},
+	{0x1faf0, 0x1faf6, UC_So}, {0x1fb00, 0x1fb92, UC_So}, {0x1fb94, 0x1fbca, UC_So},
+	{0x1fbf0, 0x1fbf9, UC_Nd}, {0x20000, 0x2a6df, UC_Lo}, {0x2a700, 0x2b738, UC_Lo},
+	{0x2b740, 0x2b81d, UC_Lo}, {0x2b820, 0x2cea1, UC_Lo}, {0x2ceb0, 0x2ebe0, UC_Lo},
+	{0x2f800, 0x2fa1d, UC_Lo}, {0x30000, 0x3134a, UC_Lo}, {0xe0001, 0xe0001, UC_Cf},
+	{0xe0020, 0xe007f, UC_Cf}, {0xe0100, 0xe01ef, UC_Mn}
+};
+
+#define NUM_UNI_RANGES (sizeof (uni_ranges) / sizeof (uni_ranges[0]))
+
+
+
+/* uniprop_lookup - find the category mask for a \p{...} property name
+ *
+ * Returns 0 if the name isn't one flex knows.
+ */
+
+int     uniprop_lookup (name)
+     const char *name;
+{
+	int     i;
+
+	for (i = 0; uni_properties[i].name; ++i)
+		if (!strcmp (uni_properties[i].name, name))
+			return uni_properties[i].mask;
+
+	return 0;
+}
+
+
+/* ccl_add_uniprop - add the code points with a property to a ccl
+ *
+ * "prop" is a mask from uniprop_lookup(), or minus one for \P{...}, in
+ * which case the code points without the property are added.
+ */
+
+void    ccl_add_uniprop (cclp, prop)
+     int     cclp, prop;
+{
+	int     mask = prop < 0 ? -prop : prop;
+	int     next = 0;
+	unsigned int i;
+
+	for (i = 0; i < NUM_UNI_RANGES; ++i) {
+		const struct uni_range *r = &uni_ranges[i];
+
+		if (!(mask & (1 << r->cat)))
+			continue;
+
+		if (prop > 0)
+			ccladd_range (cclp, r->first, r->last);
+
+		else {
+			if (r->first > next)
+				ccladd_range (cclp, next, r->first - 1);
+			next = r->last + 1;
+		}
+	}
+
+	if (prop < 0 && next <= UTF8_MAX)
+		ccladd_range (cclp, next, UTF8_MAX);
+}
@@ -0,0 +1,77 @@
+/*
+ * This file is part of flex.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the University nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND WITHOUT ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE.
+ */
+
+/* Benchmark driver for the reentrant C scanners.  Each repetition scans
+ * the whole corpus with a fresh scanner, reading it through yyin the way
+ * most programs do, so the buffer refills are part of what's measured.
+ */
+
+#include "bench.h"
+
+typedef void *yyscan_t;
+
+int yylex_init (yyscan_t *scanner);
+void yyset_in (FILE *in, yyscan_t scanner);
+int yylex (yyscan_t scanner);
+int yylex_destroy (yyscan_t scanner);
+
+int main (int argc, char **argv)
+{
+    struct bench_result best = { 0, 0, 0 };
+    int reps = bench_args (argc, argv);
+    unsigned long bytes = 0, tokens;
+    unsigned long long c0;
+    yyscan_t scanner;
+    FILE *f;
+    double t0;
+    int i;
+
+    if (!(f = fopen (argv[1], "rb"))) {
+        perror (argv[1]);
+        return 1;
+    }
+
+    fseek (f, 0L, SEEK_END);
+    bytes = (unsigned long) ftell (f);
+
+    for (i = 0; i < reps; ++i) {
+        rewind (f);
+        yylex_init (&scanner);
+        yyset_in (f, scanner);
+        tokens = 0;
+
+        t0 = bench_now ();
+        c0 = bench_cycles ();
+
+        while (yylex (scanner))
+            ++tokens;
+
+        bench_record (&best, bench_now () - t0, bench_cycles () - c0,
+                      tokens);
+        yylex_destroy (scanner);
+    }
+
+    fclose (f);
+    bench_report (argv, bytes, &best);
+    return 0;
+}
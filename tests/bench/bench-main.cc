@@ -0,0 +1,68 @@
+/*
+ * This file is part of flex.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the University nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND WITHOUT ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE.
+ */
+
+/* Benchmark driver for the C++ scanners; see bench-main.c. */
+
+#include <fstream>
+#include <FlexLexer.h>
+#include "bench.h"
+
+int main (int argc, char **argv)
+{
+    struct bench_result best = { 0, 0, 0 };
+    int reps = bench_args (argc, argv);
+    unsigned long bytes = 0, tokens;
+    unsigned long long c0;
+    double t0;
+    int i;
+
+    for (i = 0; i < reps; ++i) {
+        std::ifstream in (argv[1], std::ios::in | std::ios::binary);
+
+        if (!in) {
+            perror (argv[1]);
+            return 1;
+        }
+
+        if (!bytes) {
+            in.seekg (0, std::ios::end);
+            bytes = (unsigned long) in.tellg ();
+            in.seekg (0, std::ios::beg);
+        }
+
+        yyFlexLexer lexer (&in);
+        tokens = 0;
+
+        t0 = bench_now ();
+        c0 = bench_cycles ();
+
+        while (lexer.yylex ())
+            ++tokens;
+
+        bench_record (&best, bench_now () - t0, bench_cycles () - c0,
+                      tokens);
+    }
+
+    bench_report (argv, bytes, &best);
+    return 0;
+}
@@ -0,0 +1,114 @@
+/*
+ * This file is part of flex.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the University nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND WITHOUT ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE.
+ */
+
+/* Timing and reporting shared by the C and C++ benchmark drivers.
+ *
+ * Each run is reported on one line of "key=value" pairs:
+ *
+ *   scanner=ctok mode=-Cem flavor=r bytes=16777216 tokens=4188230
+ *   seconds=0.041230 mb_per_s=406.93 tokens_per_s=101581615
+ *   cycles_per_byte=7.41
+ *
+ * (all on one line).  The time is the best of the repetitions, and
+ * cycles_per_byte is "na" where there's no cycle counter to read.
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
+static double bench_now (void)
+{
+    struct timeval tv;
+
+    gettimeofday (&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+/* The processor's cycle counter, or 0 if we don't know how to read it. */
+static unsigned long long bench_cycles (void)
+{
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+    unsigned int lo, hi;
+
+    __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+    return ((unsigned long long) hi << 32) | lo;
+#else
+    return 0;
+#endif
+}
+
+/* The best of a benchmark's repetitions so far. */
+struct bench_result {
+    double seconds;
+    unsigned long long cycles;
+    unsigned long tokens;
+};
+
+static void bench_record (struct bench_result *best, double seconds,
+                          unsigned long long cycles, unsigned long tokens)
+{
+    if (best->seconds == 0 || seconds < best->seconds) {
+        best->seconds = seconds;
+        best->cycles = cycles;
+        best->tokens = tokens;
+    }
+}
+
+static void bench_report (char **argv, unsigned long bytes,
+                          const struct bench_result *best)
+{
+    double secs = best->seconds > 0 ? best->seconds : 1e-9;
+
+    printf ("scanner=%s mode=%s flavor=%s bytes=%lu tokens=%lu"
+            " seconds=%.6f mb_per_s=%.2f tokens_per_s=%.0f",
+            argv[2], argv[3], argv[4], bytes, best->tokens, best->seconds,
+            bytes / secs / 1e6, best->tokens / secs);
+
+    if (best->cycles)
+        printf (" cycles_per_byte=%.2f\n", (double) best->cycles / bytes);
+    else
+        printf (" cycles_per_byte=na\n");
+}
+
+/* Checks the arguments, "CORPUS SCANNER MODE FLAVOR [REPETITIONS]", and
+ * returns how many repetitions to run.
+ */
+static int bench_args (int argc, char **argv)
+{
+    int reps = argc > 5 ? atoi (argv[5]) : 5;
+
+    if (argc < 5 || reps < 1) {
+        fprintf (stderr,
+                 "usage: %s CORPUS SCANNER MODE FLAVOR [REPETITIONS]\n",
+                 argv[0]);
+        exit (1);
+    }
+
+    return reps;
+}
+
+#endif /* BENCH_H */
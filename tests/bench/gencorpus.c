@@ -0,0 +1,276 @@
+/*
+ * This file is part of flex.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the University nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND WITHOUT ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE.
+ */
+
+/* Writes one of the benchmark corpora to stdout: "gencorpus KIND SIZE".
+ * The text comes from a fixed-seed generator, so every run, and every
+ * machine, gets the same corpus of (about) SIZE bytes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static unsigned long seed = 12345;
+
+/* A number from 0 to n - 1. */
+static unsigned long rnd (unsigned long n)
+{
+    seed = (seed * 1103515245UL + 12345UL) & 0x7fffffffUL;
+    return (seed >> 8) % n;
+}
+
+static const char *pick (const char **words, int n)
+{
+    return words[rnd (n)];
+}
+
+/* Writes an identifier and returns its length. */
+static int ident (void)
+{
+    static const char first[] = "abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJ";
+    static const char rest[] = "abcdefghijklmnopqrstuvwxyz_0123456789";
+    int len = 1 + rnd (10), i;
+
+    putchar (first[rnd (sizeof (first) - 1)]);
+    for (i = 1; i < len; ++i)
+        putchar (rest[rnd (sizeof (rest) - 1)]);
+
+    return len;
+}
+
+static const char *ctypes[] = {
+    "int", "char", "unsigned long", "struct node *", "double", "size_t",
+};
+
+static const char *cops[] = {
+    " = ", " + ", " - ", " * ", " / ", " == ", " != ", " <= ", " >= ",
+    " && ", " || ", " << ", " >> ", " += ", "->", ".", " ? ", " : ",
+};
+
+/* C source: functions full of declarations, expressions, calls,
+ * strings, character constants and comments.
+ */
+static long gen_ctok (long size)
+{
+    long n = 0;
+
+    while (n < size) {
+        int stmts = 3 + rnd (12), i;
+
+        if (rnd (4) == 0)
+            n += printf ("#include <%s.h>\n", rnd (2) ? "stdio" : "stdlib");
+
+        n += printf ("/* Function number %lu: does some work. */\n",
+                     rnd (100000));
+        n += printf ("static %s ", pick (ctypes, 6));
+        n += ident ();
+        n += printf (" (%s a, %s b)\n{\n", pick (ctypes, 6),
+                     pick (ctypes, 6));
+
+        for (i = 0; i < stmts; ++i) {
+            n += printf ("    ");
+            switch (rnd (5)) {
+            case 0:
+                n += printf ("%s ", pick (ctypes, 6));
+                n += ident ();
+                n += printf (" = %lu;", rnd (1000000));
+                break;
+            case 1:
+                n += ident ();
+                n += printf ("%s", pick (cops, 18));
+                n += ident ();
+                n += printf ("%s%lu.%lue%lu;", pick (cops, 18), rnd (1000),
+                             rnd (1000), rnd (30));
+                break;
+            case 2:
+                n += printf ("printf (\"value %%d: %%s\\n\", ");
+                n += ident ();
+                n += printf (", \"text\");");
+                break;
+            case 3:
+                n += printf ("if (");
+                n += ident ();
+                n += printf (" == '%c')\n        return 0x%lx;",
+                             (int) ('a' + rnd (26)), rnd (65536));
+                break;
+            default:
+                n += printf ("// line comment %lu", rnd (1000));
+                break;
+            }
+            n += printf ("\n");
+        }
+
+        n += printf ("    return a;\n}\n\n");
+    }
+
+    return n;
+}
+
+static const char *levels[] = { "INFO", "WARN", "ERROR", "DEBUG" };
+
+/* Log lines, half of them with a CSV payload of plain and quoted fields. */
+static long gen_csv (long size)
+{
+    long n = 0;
+
+    while (n < size) {
+        int fields = 2 + rnd (8), i;
+
+        n += printf ("2024-%02lu-%02lu %02lu:%02lu:%02lu.%03lu %s ",
+                     1 + rnd (12), 1 + rnd (28), rnd (24), rnd (60),
+                     rnd (60), rnd (1000), pick (levels, 4));
+
+        for (i = 0; i < fields; ++i) {
+            if (i)
+                n += printf (",");
+
+            switch (rnd (4)) {
+            case 0:
+                n += printf ("%lu", rnd (100000000));
+                break;
+            case 1:
+                n += printf ("\"quoted, with \"\"quotes\"\" %lu\"",
+                             rnd (1000));
+                break;
+            case 2:
+                break;
+            default:
+                n += ident ();
+                break;
+            }
+        }
+
+        n += printf ("\n");
+    }
+
+    return n;
+}
+
+static const char *keywords[] = {
+    "abstract", "and", "array", "as", "assert", "begin", "break", "case",
+    "catch", "class", "const", "continue", "def", "default", "do", "downto",
+    "else", "elsif", "end", "enum", "except", "export", "extends", "false",
+    "final", "finally", "for", "foreach", "from", "function", "global",
+    "goto", "if", "implements", "import", "in", "interface", "is", "lambda",
+    "let", "loop", "match", "module", "new", "nil", "not", "of", "or",
+    "package", "private", "procedure", "protected", "public", "raise",
+    "record", "repeat", "return", "select", "self", "static", "struct",
+    "super", "switch", "then", "this", "throw", "to", "true", "try", "type",
+    "until", "var", "when", "where", "while", "with", "yield",
+};
+
+#define NUM_KEYWORDS ((int) (sizeof (keywords) / sizeof (keywords[0])))
+
+/* A made-up language that's mostly keywords, with a few identifiers
+ * (some of them keyword prefixes), numbers and punctuation.
+ */
+static long gen_keywords (long size)
+{
+    static const char *punct[] = { " := ", "; ", "(", ")", ", ", " <> ", "\n" };
+    long n = 0;
+
+    while (n < size) {
+        switch (rnd (8)) {
+        case 0:
+            n += ident ();
+            break;
+        case 1:
+            n += printf ("%s%c", pick (keywords, NUM_KEYWORDS),
+                         (int) ('a' + rnd (26)));
+            break;
+        case 2:
+            n += printf ("%lu", rnd (100000));
+            break;
+        default:
+            n += printf ("%s", pick (keywords, NUM_KEYWORDS));
+            break;
+        }
+
+        n += printf ("%s", rnd (3) ? " " : pick (punct, 7));
+    }
+
+    return n;
+}
+
+/* Records of a binary protocol: a type byte, a big-endian 16-bit length,
+ * then fields that are mostly zeros, counted strings and padding.
+ */
+static long gen_binproto (long size)
+{
+    long n = 0;
+
+    while (n < size) {
+        int len = 4 + rnd (60), i;
+
+        putchar (0x80 | rnd (8));
+        putchar (len >> 8);
+        putchar (len & 0xff);
+        n += 3;
+
+        for (i = 0; i < len; ++i, ++n)
+            switch (rnd (6)) {
+            case 0:
+            case 1:
+            case 2:
+                putchar (0);
+                break;
+            case 3:
+                putchar (1 + rnd (127));
+                break;
+            default:
+                putchar (0x80 + rnd (128));
+                break;
+            }
+
+        putchar ('\n');
+        ++n;
+    }
+
+    return n;
+}
+
+int main (int argc, char **argv)
+{
+    long size = argc > 2 ? atol (argv[2]) : 0;
+
+    if (size <= 0) {
+        fprintf (stderr, "usage: %s ctok|csv|keywords|binproto SIZE\n",
+                 argv[0]);
+        return 1;
+    }
+
+    if (!strcmp (argv[1], "ctok"))
+        gen_ctok (size);
+    else if (!strcmp (argv[1], "csv"))
+        gen_csv (size);
+    else if (!strcmp (argv[1], "keywords"))
+        gen_keywords (size);
+    else if (!strcmp (argv[1], "binproto"))
+        gen_binproto (size);
+    else {
+        fprintf (stderr, "%s: unknown corpus \"%s\"\n", argv[0], argv[1]);
+        return 1;
+    }
+
+    return 0;
+}
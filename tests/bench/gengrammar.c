@@ -0,0 +1,97 @@
+/*
+ * This file is part of flex.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * Neither the name of the University nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND WITHOUT ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE.
+ */
+
+/* Writes a flex input with N rules to stdout: "gengrammar N".  It stands
+ * in for the machine-generated grammars flex is sometimes fed: mostly
+ * keywords, with identifier-like and number-like patterns mixed in.  Every
+ * rule gets its own name, so none of them is shadowed by another, and the
+ * same N always gives the same input.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static unsigned long seed = 54321;
+
+/* A number from 0 to n - 1. */
+static unsigned long rnd (unsigned long n)
+{
+    seed = (seed * 1103515245UL + 12345UL) & 0x7fffffffUL;
+    return (seed >> 8) % n;
+}
+
+/* Writes a word that no other rule's word starts the same way: a few
+ * random letters and then rule i's number in base 26.
+ */
+static void word (long i)
+{
+    int len = 2 + rnd (6), n;
+
+    for (n = 0; n < len; ++n)
+        putchar ('a' + rnd (26));
+
+    do {
+        putchar ('a' + i % 26);
+        i /= 26;
+    } while (i > 0);
+}
+
+int main (int argc, char **argv)
+{
+    long nrules, i;
+
+    if (argc != 2 || (nrules = atol (argv[1])) < 1) {
+        fprintf (stderr, "usage: gengrammar N\n");
+        return 1;
+    }
+
+    printf ("%%option 8bit noyywrap nounput noinput\n%%%%\n");
+
+    for (i = 0; i < nrules; ++i) {
+        switch (i % 4) {
+        case 0:
+            putchar ('"');
+            word (i);
+            putchar ('"');
+            break;
+        case 1:
+            word (i);
+            printf ("[0-9]+");
+            break;
+        case 2:
+            word (i);
+            printf ("(\".\"[a-z]+)?");
+            break;
+        default:
+            printf ("[A-Z]");
+            word (i);
+            printf ("[a-z0-9_]*");
+            break;
+        }
+
+        printf ("\treturn %ld;\n", i + 1);
+    }
+
+    printf (".|\\n\t;\n");
+    return 0;
+}
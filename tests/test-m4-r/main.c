@@ -0,0 +1,47 @@
+/*
+ * This file is part of flex.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the University nor the names of its contributors
+ * may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED ``AS IS'' AND WITHOUT ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE.
+ */
+
+#include <stdio.h>
+#include "scanner.h"
+
+extern int testcount (int i, int j);
+
+int
+main ( int argc, char** argv )
+{
+    yyscan_t  scanner;
+
+    (void) argc;
+    (void) argv;
+
+    testlex_init(&scanner);
+    testset_in(stdin,scanner);
+    while(testlex(scanner))
+        ;
+    printf("%d bracketed, %d empty, %d words, %d lines\n",
+           testcount(0, 1), testcount(0, 0), testcount(1, 0),
+           testget_lineno(scanner));
+    testlex_destroy(scanner);
+    printf("TEST RETURNING OK.\n");
+    return 0;
+}
@@ -0,0 +1,70 @@
+# Checks a scanner built with --tables-source against the same scanner
+# built with its tables inline:
+#
+#   awk -v prefix=PREFIX -f check-tables.awk INLINE.c SPLIT.c TABLES.c
+#
+# Each table the inline build defines must only be declared in the
+# split build and be defined in the tables file, under its name with
+# the prefix, except for yy_NUL_trans, which stays in the scanner.
+# The tables file mustn't define anything else.
+
+function table(line)
+{
+  match(line, /yy_[a-zA-Z_]+\[/);
+  return substr(line, RSTART, RLENGTH - 1);
+}
+
+FNR == 1 { ++file }
+
+file == 1 && /^static yyconst .*yy_[a-zA-Z_]+\[.*=$/ { inline[table($0)] = 1 }
+
+file == 2 && /^static yyconst .*yy_[a-zA-Z_]+\[.*=$/ { split_static[table($0)] = 1 }
+file == 2 && /^extern yyconst .*yy_[a-zA-Z_]+\[.*;$/ { split_extern[table($0)] = 1 }
+file == 2 && /^#define yy_[a-zA-Z_]+ / { split_define[$2] = $3 }
+
+file == 3 && /^yyconst .*yy_[a-zA-Z_]+\[.*=$/ { defined[table($0)] = 1 }
+file == 3 && /^#define yy_[a-zA-Z_]+ / { tables_define[$2] = $3 }
+
+END {
+  status = 0;
+  n = 0;
+
+  for (t in inline) {
+    ++n;
+    renamed = prefix substr(t, 3);
+
+    if (t == "yy_NUL_trans") {
+      if (!split_static[t] || defined[t]) {
+        printf "%s isn't defined in the scanner\n", t;
+        status = 1;
+      }
+      continue;
+    }
+
+    if (split_static[t] || !split_extern[t]) {
+      printf "%s isn't only declared in the scanner\n", t;
+      status = 1;
+    }
+    if (!defined[t]) {
+      printf "%s isn't defined in the tables file\n", t;
+      status = 1;
+    }
+    if (split_define[t] != renamed || tables_define[t] != renamed) {
+      printf "%s isn't renamed %s\n", t, renamed;
+      status = 1;
+    }
+  }
+
+  for (t in defined)
+    if (!inline[t]) {
+      printf "%s is defined in the tables file only\n", t;
+      status = 1;
+    }
+
+  if (n == 0) {
+    print "no tables found";
+    status = 1;
+  }
+
+  exit status;
+}